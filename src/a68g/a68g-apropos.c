@@ -76,8 +76,11 @@ static A68_INFO info_text[] = {
   {"monitor", "xref \"n\"", "give detailed information on source line \"n\""},
   {"options", "--assertions, --noassertions", "switch elaboration of assertions on or off"},
   {"options", "--backtrace, --nobacktrace", "switch stack backtracing in case of a runtime error"},
+  {"options", "--blas, --noblas", "compute matrix products with the CBLAS library or with the built-in kernel; --blas requires GSL"},
   {"options", "--boldstropping", "set stropping mode to bold stropping"},
   {"options", "--brackets", "consider [ .. ] and { .. } as equivalent to ( .. )"},
+  {"options", "--bytecode, --nobytecode", "switch lowering of loops and conditionals to threaded code on or off"},
+  {"options", "--cache, --nocache", "switch the cache of compiled plugins on or off"},
   {"options", "--check, --norun", "check syntax only, interpreter does not start"},
   {"options", "--clock", "report execution time excluding compilation time"},
   {"options", "--compile", "compile source file"},
@@ -102,6 +105,7 @@ static A68_INFO info_text[] = {
   {"options", "--preludelisting", "make a listing of preludes"},
   {"options", "--pretty-print", "pretty-print the source file"},
   {"options", "--print unit", "print value yielded by algol 68 unit \"unit\""},
+  {"options", "--profile, --noprofile", "switch profiling of a running program on or off"},
   {"options", "--quiet", "suppresses all warning diagnostics"},
   {"options", "--quotestropping", "set stropping mode to quote stropping"},
   {"options", "--reductions", "print parser reductions"},
@@ -151,7 +151,9 @@ void isolate_options (char *p, LINE_T * line)
 void default_options (MODULE_T * p)
 {
   OPTION_BACKTRACE (p) = A68_FALSE;
+  OPTION_BLAS (p) = A68_FALSE;
   OPTION_BRACKETS (p) = A68_FALSE;
+  OPTION_BYTECODE (p) = A68_FALSE;
   OPTION_CHECK_ONLY (p) = A68_FALSE;
   OPTION_CLOCK (p) = A68_FALSE;
   OPTION_COMPILE_CHECK (p) = A68_FALSE;
@@ -173,6 +175,7 @@ void default_options (MODULE_T * p)
   OPTION_REDUCTIONS (p) = A68_FALSE;
   OPTION_REGRESSION_TEST (p) = A68_FALSE;
   OPTION_RERUN (p) = A68_FALSE;
+  OPTION_CACHE (p) = A68_TRUE;
   OPTION_RUN (p) = A68_FALSE;
   OPTION_RUN_SCRIPT (p) = A68_FALSE;
   OPTION_SOURCE_LISTING (p) = A68_FALSE;
@@ -182,6 +185,7 @@ void default_options (MODULE_T * p)
   OPTION_STROPPING (p) = UPPER_STROPPING;
   OPTION_TIME_LIMIT (p) = 0;
   OPTION_TRACE (p) = A68_FALSE;
+  OPTION_PROFILE (p) = A68_FALSE;
   OPTION_TREE_LISTING (p) = A68_FALSE;
   OPTION_UNUSED (p) = A68_FALSE;
   OPTION_VERBOSE (p) = A68_FALSE;
@@ -838,6 +842,14 @@ BOOL_T set_options (OPTION_LIST_T *i, BOOL_T cmd_line)
             OPTION_OPT_LEVEL (&A68_JOB) = OPTIMISE_1;
           }
         }
+// CACHE and NOCACHE switch on/off the cache of compiled plugins.
+        else if (eq (p, "CACHE")) {
+          OPTION_CACHE (&A68_JOB) = A68_TRUE;
+        } else if (eq (p, "NOCACHE")) {
+          OPTION_CACHE (&A68_JOB) = A68_FALSE;
+        } else if (eq (p, "NO-CACHE")) {
+          OPTION_CACHE (&A68_JOB) = A68_FALSE;
+        }
 // KEEP and NOKEEP switch off/on object file deletion.
         else if (eq (p, "KEEP")) {
           OPTION_KEEP (&A68_JOB) = A68_TRUE;
@@ -846,10 +858,30 @@ BOOL_T set_options (OPTION_LIST_T *i, BOOL_T cmd_line)
         } else if (eq (p, "NO-KEEP")) {
           OPTION_KEEP (&A68_JOB) = A68_FALSE;
         }
+// BLAS and NOBLAS select the CBLAS library or the built-in kernel for matrix products.
+        else if (eq (p, "BLas")) {
+#if defined (HAVE_GSL)
+          OPTION_BLAS (&A68_JOB) = A68_TRUE;
+#else
+          option_error (start_l, start_c, "GSL-only option");
+#endif
+        } else if (eq (p, "NOBLas")) {
+          OPTION_BLAS (&A68_JOB) = A68_FALSE;
+        } else if (eq (p, "NO-BLas")) {
+          OPTION_BLAS (&A68_JOB) = A68_FALSE;
+        }
 // BRACKETS extends Algol 68 syntax for brackets.
         else if (eq (p, "BRackets")) {
           OPTION_BRACKETS (&A68_JOB) = A68_TRUE;
         }
+// BYTECODE and NOBYTECODE switch on/off lowering of statements to threaded code.
+        else if (eq (p, "BYtecode")) {
+          OPTION_BYTECODE (&A68_JOB) = A68_TRUE;
+        } else if (eq (p, "NOBYtecode")) {
+          OPTION_BYTECODE (&A68_JOB) = A68_FALSE;
+        } else if (eq (p, "NO-BYtecode")) {
+          OPTION_BYTECODE (&A68_JOB) = A68_FALSE;
+        }
 // PRETTY and INDENT perform basic pretty printing.
 // This is meant for synthetic code.
         else if (eq (p, "PRETty-print")) {
@@ -1102,6 +1134,17 @@ BOOL_T set_options (OPTION_LIST_T *i, BOOL_T cmd_line)
         } else if (eq (p, "NO-TRace")) {
           OPTION_NODEMASK (&A68_JOB) &= ~BREAKPOINT_TRACE_MASK;
         }
+// PROFILE and NOPROFILE switch on/off profiling of the running program.
+        else if (eq (p, "PROFile")) {
+          OPTION_PROFILE (&A68_JOB) = A68_TRUE;
+          OPTION_NODEMASK (&A68_JOB) |= PROFILE_MASK;
+        } else if (eq (p, "NOPROFile")) {
+          OPTION_PROFILE (&A68_JOB) = A68_FALSE;
+          OPTION_NODEMASK (&A68_JOB) &= ~PROFILE_MASK;
+        } else if (eq (p, "NO-PROFile")) {
+          OPTION_PROFILE (&A68_JOB) = A68_FALSE;
+          OPTION_NODEMASK (&A68_JOB) &= ~PROFILE_MASK;
+        }
 // TIMELIMIT lets the interpreter stop after so-many seconds.
         else if (eq (p, "TImelimit") || eq (p, "TIME-Limit")) {
           BOOL_T error = A68_FALSE;
@@ -22,16 +22,90 @@
 //! @section Synopsis
 //!
 //! Postulates needed for proving equivalence of modes.
+//! Postulate lists are stacks, but proofs query them for every pair of modes
+//! they meet, so live postulates are also indexed by hash of their pair.
 
 #include "a68g.h"
 #include "a68g-postulates.h"
 
+//! @brief Forget all disproofs.
+
+static void init_disproofs (void)
+{
+  for (int k = 0; k < DISPROOF_BUCKETS; k++) {
+    A68 (disproofs)[k].proof = 0;
+  }
+  A68 (proof_count) = 1;
+}
+
 //! @brief Initialise use of postulate-lists.
 
 void init_postulates (void)
 {
   A68 (top_postulate) = NO_POSTULATE;
   A68 (top_postulate_list) = NO_POSTULATE;
+  for (int k = 0; k < POSTULATE_BUCKETS; k++) {
+    A68 (postulate_index)[k] = NO_POSTULATE;
+  }
+  init_disproofs ();
+}
+
+//! @brief Hash bucket of postulate (a, b).
+
+static int postulate_bucket (const MOID_T * a, const MOID_T * b)
+{
+  uintptr_t h = ((uintptr_t) a >> 4) * 31 + ((uintptr_t) b >> 4);
+  return (int) ((h ^ (h >> 10)) & (POSTULATE_BUCKETS - 1));
+}
+
+//! @brief Start a new proof, forgetting disproofs of earlier ones.
+
+void new_proof (void)
+{
+  if (++A68 (proof_count) == 0) {
+    init_disproofs ();
+  }
+}
+
+//! @brief Disproof slot of pair (a, b).
+
+static DISPROOF_T *disproof_slot (const MOID_T * a, const MOID_T * b)
+{
+  uintptr_t h = ((uintptr_t) a >> 4) * 31 + ((uintptr_t) b >> 4);
+  return &A68 (disproofs)[(h ^ (h >> 12)) & (DISPROOF_BUCKETS - 1)];
+}
+
+//! @brief Remember that "a" and "b" are not equivalent.
+
+void make_disproof (MOID_T * a, MOID_T * b)
+{
+// A proof that fails under postulates also fails without them, so the pair
+// is not equivalent whatever is postulated later in the same proof.
+  DISPROOF_T *d = disproof_slot (a, b);
+  d->a = a;
+  d->b = b;
+  d->proof = A68 (proof_count);
+}
+
+//! @brief Whether "a" and "b" were found not equivalent in the current proof.
+
+BOOL_T is_disproved (const MOID_T * a, const MOID_T * b)
+{
+  DISPROOF_T *d = disproof_slot (a, b);
+  return d->proof == A68 (proof_count) && d->a == a && d->b == b;
+}
+
+//! @brief Remove postulate from the index.
+
+static void unindex_postulate (POSTULATE_T * p)
+{
+  POSTULATE_T **q = &A68 (postulate_index)[postulate_bucket (A (p), B (p))];
+  for (; *q != NO_POSTULATE && *q != p; q = &HOMONYM (*q)) {
+    ;
+  }
+  if (*q == p) {
+    *q = HOMONYM (p);
+  }
 }
 
 //! @brief Make old postulates available for new use.
@@ -42,8 +116,9 @@ void free_postulate_list (POSTULATE_T * start, const POSTULATE_T * stop)
     return;
   }
   POSTULATE_T *last = start;
+  unindex_postulate (last);
   for (; NEXT (last) != stop; FORWARD (last)) {
-    ;
+    unindex_postulate (NEXT (last));
   }
   NEXT (last) = A68 (top_postulate_list);
   A68 (top_postulate_list) = start;
@@ -65,15 +140,20 @@ void make_postulate (POSTULATE_T ** p, MOID_T * a, MOID_T * b)
   B (new_one) = b;
   NEXT (new_one) = *p;
   *p = new_one;
+  POSTULATE_T **q = &A68 (postulate_index)[postulate_bucket (a, b)];
+  HOMONYM (new_one) = *q;
+  *q = new_one;
 }
 
-//! @brief Where postulates are in the list.
+//! @brief Where pair (a, b) is among the live postulates.
 
-POSTULATE_T *is_postulated_pair (POSTULATE_T * p, const MOID_T * a, const MOID_T * b)
+POSTULATE_T *is_postulated_pair (const MOID_T * a, const MOID_T * b)
 {
-  for (; p != NO_POSTULATE; FORWARD (p)) {
-    if (A (p) == a && B (p) == b) {
-      return p;
+// Other lists only hold (mode, NO_MOID), which never matches a pair, so
+// the index of all live postulates stands in for the list of the proof.
+  for (POSTULATE_T *q = A68 (postulate_index)[postulate_bucket (a, b)]; q != NO_POSTULATE; q = HOMONYM (q)) {
+    if (A (q) == a && B (q) == b) {
+      return q;
     }
   }
   return NO_POSTULATE;
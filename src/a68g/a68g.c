@@ -25,8 +25,11 @@
 
 // --assertions, --noassertions, switch elaboration of assertions on or off.
 // --backtrace, --nobacktrace, switch stack backtracing in case of a runtime error.
+// --blas, --noblas, compute matrix products with the CBLAS library or with the built-in kernel; --blas requires GSL.
 // --boldstropping, set stropping mode to bold stropping.
 // --brackets, consider [ .. ] and { .. } as equivalent to ( .. ).
+// --bytecode, --nobytecode, switch lowering of loops and conditionals to threaded code on or off.
+// --cache, --nocache, switch the cache of compiled plugins on or off.
 // --check, --norun, check syntax only, interpreter does not start.
 // --clock, report execution time excluding compilation time.
 // --compile, compile source file.
@@ -51,6 +54,7 @@
 // --preludelisting, make a listing of preludes.
 // --pretty-print, pretty-print the source file.
 // --print unit, print value yielded by algol 68 unit 'unit'.
+// --profile, --noprofile, switch profiling of a running program on or off.
 // --quiet, suppresses all warning diagnostics.
 // --quotestropping, set stropping mode to quote stropping.
 // --reductions, print parser reductions.
@@ -347,6 +351,8 @@ void compiler_interpreter (void)
   A68_PARSER (stop_scanner) = A68_FALSE;
   A68_PARSER (read_error) = A68_FALSE;
   A68_PARSER (no_preprocessing) = A68_FALSE;
+  A68_PARSER (mode_index) = NO_VAR;
+  A68_PARSER (tag_indices) = NO_TAG_INDEX;
   A68_PARSER (reductions) = 0;
   A68_PARSER (tag_number) = 0;
   A68 (curses_mode) = A68_FALSE;
@@ -358,6 +364,17 @@ void compiler_interpreter (void)
   A68_MP (mp_gamma_size) = -1;
   A68_MP (mp_one_size) = -1;
   A68_MP (mp_pi_size) = -1;
+  A68_MP (mp_scratch) = NO_BYTE;
+  A68_MP (mp_scratch_size) = 0;
+  A68_MP (mp_scratch_top) = 0;
+  A68_MP (mp_scratch_want) = 0;
+  for (int k = 0; k < REGEX_CACHE_SIZE; k++) {
+    A68_REGEX (cache)[k].pattern = NO_TEXT;
+    A68_REGEX (cache)[k].matches = NO_REGMATCH;
+  }
+  A68_REGEX (clock) = 0;
+  A68_REGEX (hits) = 0;
+  A68_REGEX (misses) = 0;
 // File set-up.
   SCAN_ERROR (FILE_INITIAL_NAME (&A68_JOB) == NO_TEXT, NO_LINE, NO_TEXT, ERROR_NO_SOURCE_FILE);
   FILE_BINARY_OPENED (&A68_JOB) = A68_FALSE;
@@ -572,6 +589,9 @@ void a68_exit (int code)
   a68_free (FILE_SCRIPT_NAME (&A68_JOB));
   a68_free (FILE_DIAGS_NAME (&A68_JOB));
   a68_free (A68_MP (mp_one));
+  a68_free (A68_MP (mp_scratch));
+  free_regex_cache ();
+  free_tag_indices ();
   a68_free (A68_MP (mp_pi));
   a68_free (A68_MP (mp_half_pi));
   a68_free (A68_MP (mp_two_pi));
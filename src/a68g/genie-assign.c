@@ -74,6 +74,28 @@ PROP_T genie_voiding_assignation (NODE_T * p)
   return self;
 }
 
+//! @brief Assign a scalar to a name held by an identifier and voiden.
+
+PROP_T genie_voiding_assignation_identifier (NODE_T * p)
+{
+  NODE_T *dst = SUB (p);
+  NODE_T *src = NEXT_NEXT (dst);
+  ADDR_T pop_sp = A68_SP, pop_fp = FRAME_DNS (A68_FP);
+  A68_REF *z;
+  PROP_T self;
+  UNIT (&self) = genie_voiding_assignation_identifier;
+  SOURCE (&self) = p;
+// Fetch the name from the frame; a scalar needs no scope check.
+  FRAME_GET (z, A68_REF, SOURCE (&GPROP (dst)));
+  CHECK_REF (p, *z, MOID (p));
+  FRAME_DNS (A68_FP) = REF_SCOPE (z);
+  GENIE_UNIT (src);
+  FRAME_DNS (A68_FP) = pop_fp;
+  A68_SP = pop_sp;
+  COPY_ALIGNED (ADDRESS (z), STACK_TOP, SIZE (SUB_MOID (dst)));
+  return self;
+}
+
 //! @brief Assign a value to a name and push the name.
 
 PROP_T genie_assignation_constant (NODE_T * p)
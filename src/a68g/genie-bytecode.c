@@ -0,0 +1,1091 @@
+//! @file genie-bytecode.c
+//! @author J. Marcel van der Veer
+
+//! @section Copyright
+//!
+//! This file is part of Algol68G - an Algol 68 compiler-interpreter.
+//! Copyright 2001-2024 J. Marcel van der Veer [algol68g@xs4all.nl].
+
+//! @section License
+//!
+//! This program is free software; you can redistribute it and/or modify it
+//! under the terms of the GNU General Public License as published by the
+//! Free Software Foundation; either version 3 of the License, or
+//! (at your option) any later version.
+//!
+//! This program is distributed in the hope that it will be useful, but
+//! WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+//! or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+//! more details. You should have received a copy of the GNU General Public
+//! License along with this program. If not, see [http://www.gnu.org/licenses/].
+
+//! @section Synopsis
+//!
+//! Threaded code for loops and conditionals.
+
+// With --bytecode, a VOID loop or conditional clause in a serial clause is
+// lowered into a linear sequence of instructions that run on a small value
+// stack with direct-threaded dispatch. Lowering reads the propagators that the
+// first executions selected, so it knows which identifiers are frame
+// identifiers, which variables are proven initialised and which operators are
+// standard ones. Scalar INT, REAL and BOOL formulas, assignations, OP AND
+// BECOMES, nested conditionals and counting loops become instructions; any
+// other unit is executed through its propagator by an EXEC or CALL instruction.
+// Ranges that hold no tags and only contain instructions need no frame.
+// Every instruction keeps the node it was lowered from, for diagnostics and
+// for the monitor.
+
+#include "a68g.h"
+#include "a68g-genie.h"
+#include "a68g-frames.h"
+#include "a68g-prelude.h"
+
+// Instructions.
+
+enum
+{
+  BC_NOP = 0, BC_END, BC_TRACE, BC_EXEC, BC_SERIAL, BC_GC,
+  BC_CALL_INT, BC_CALL_REAL, BC_CALL_BOOL,
+  BC_PUSH_INT, BC_PUSH_REAL, BC_PUSH_BOOL,
+  BC_LOAD_INT, BC_LOAD_REAL, BC_LOAD_BOOL,
+  BC_DEREF_LOC_INT, BC_DEREF_LOC_REAL,
+  BC_DEREF_INT, BC_DEREF_REAL, BC_DEREF_BOOL,
+  BC_WIDEN, BC_MINUS_INT, BC_MINUS_REAL, BC_NOT_BOOL,
+  BC_ADD_INT, BC_SUB_INT, BC_MUL_INT, BC_OVER_INT, BC_MOD_INT,
+  BC_EQ_INT, BC_NE_INT, BC_LT_INT, BC_GT_INT, BC_LE_INT, BC_GE_INT,
+  BC_ADD_REAL, BC_SUB_REAL, BC_MUL_REAL, BC_DIV_REAL,
+  BC_EQ_REAL, BC_NE_REAL, BC_LT_REAL, BC_GT_REAL, BC_LE_REAL, BC_GE_REAL,
+  BC_EQ_BOOL, BC_NE_BOOL,
+  BC_NAME, BC_STORE_INT, BC_STORE_REAL, BC_STORE_BOOL,
+  BC_PLUSAB_INT, BC_MINUSAB_INT, BC_TIMESAB_INT,
+  BC_PLUSAB_REAL, BC_MINUSAB_REAL, BC_TIMESAB_REAL,
+  BC_JUMP, BC_JUMP_FALSE, BC_FRAME_OPEN, BC_FRAME_CLOSE,
+  BC_LOOP_TO, BC_LOOP_TEST, BC_LOOP_SET, BC_LOOP_NEXT, BC_LOOP_END,
+  BC_OPCODES
+};
+
+typedef union BC_VALUE_T BC_VALUE_T;
+typedef struct INSTRUCTION_T INSTRUCTION_T;
+typedef struct EMITTER_T EMITTER_T;
+
+union BC_VALUE_T
+{
+  INT_T i;
+  REAL_T r;
+  BOOL_T b;
+  BYTE_T *a;
+};
+
+struct INSTRUCTION_T
+{
+  int code;
+  void *label;
+  NODE_T *node, *aux;
+  union
+  {
+    INT_T i;
+    REAL_T r;
+    int target;
+  } arg;
+};
+
+struct BYTECODE_T
+{
+  PROP_T propagator;
+  INSTRUCTION_T *code;
+  int size, count, resume;
+  BOOL_T threaded;
+};
+
+struct EMITTER_T
+{
+  INSTRUCTION_T *code;
+  int size, max, depth, max_depth, calls, resume;
+  BOOL_T pending, failed;
+};
+
+#define NO_BC_VALUE ((BC_VALUE_T *) NULL)
+#define NO_INSTRUCTION ((INSTRUCTION_T *) NULL)
+
+// Values on the bytecode stack per activation, and how often lowering of a
+// statement is retried while parts of it have not run yet.
+
+#define BYTECODE_DEPTH 32
+#define BYTECODE_PATIENCE 64
+
+// Standard operators that lower to a single instruction.
+
+typedef struct BC_OPERATOR_T BC_OPERATOR_T;
+
+struct BC_OPERATOR_T
+{
+  GPROC *procedure;
+  int code;
+};
+
+static BC_OPERATOR_T bytecode_int_dyadics[] = {
+  {genie_add_int, BC_ADD_INT},
+  {genie_sub_int, BC_SUB_INT},
+  {genie_mul_int, BC_MUL_INT},
+  {genie_over_int, BC_OVER_INT},
+  {genie_mod_int, BC_MOD_INT},
+  {genie_eq_int, BC_EQ_INT},
+  {genie_ne_int, BC_NE_INT},
+  {genie_lt_int, BC_LT_INT},
+  {genie_gt_int, BC_GT_INT},
+  {genie_le_int, BC_LE_INT},
+  {genie_ge_int, BC_GE_INT},
+  {NO_GPROC, BC_NOP}
+};
+
+static BC_OPERATOR_T bytecode_real_dyadics[] = {
+  {genie_add_real, BC_ADD_REAL},
+  {genie_sub_real, BC_SUB_REAL},
+  {genie_mul_real, BC_MUL_REAL},
+  {genie_div_real, BC_DIV_REAL},
+  {genie_eq_real, BC_EQ_REAL},
+  {genie_ne_real, BC_NE_REAL},
+  {genie_lt_real, BC_LT_REAL},
+  {genie_gt_real, BC_GT_REAL},
+  {genie_le_real, BC_LE_REAL},
+  {genie_ge_real, BC_GE_REAL},
+  {NO_GPROC, BC_NOP}
+};
+
+static BC_OPERATOR_T bytecode_bool_dyadics[] = {
+  {genie_eq_bool, BC_EQ_BOOL},
+  {genie_ne_bool, BC_NE_BOOL},
+  {NO_GPROC, BC_NOP}
+};
+
+static BC_OPERATOR_T bytecode_int_becomes[] = {
+  {genie_plusab_int, BC_PLUSAB_INT},
+  {genie_minusab_int, BC_MINUSAB_INT},
+  {genie_timesab_int, BC_TIMESAB_INT},
+  {NO_GPROC, BC_NOP}
+};
+
+static BC_OPERATOR_T bytecode_real_becomes[] = {
+  {genie_plusab_real, BC_PLUSAB_REAL},
+  {genie_minusab_real, BC_MINUSAB_REAL},
+  {genie_timesab_real, BC_TIMESAB_REAL},
+  {NO_GPROC, BC_NOP}
+};
+
+//! @brief Instruction for standard operator "f" in table "t".
+
+static int bytecode_operator (BC_OPERATOR_T * t, GPROC * f)
+{
+  for (; PROCEDURE (t) != NO_GPROC; t++) {
+    if (PROCEDURE (t) == f) {
+      return t->code;
+    }
+  }
+  return BC_NOP;
+}
+
+//! @brief Whether "m" is a mode that lives on the bytecode stack.
+
+static BOOL_T is_bytecode_mode (MOID_T * m)
+{
+  return (BOOL_T) (m == M_INT || m == M_REAL || m == M_BOOL);
+}
+
+//! @brief Whether a range needs no frame of its own.
+
+static BOOL_T is_frameless (NODE_T * p)
+{
+  return (BOOL_T) (AP_INCREMENT (TABLE (p)) == 0 && !INITIALISE_FRAME (TABLE (p)));
+}
+
+//! @brief Append an instruction that changes stack depth by "effect".
+
+static int emit (EMITTER_T * e, int code, NODE_T * node, NODE_T * aux, int effect)
+{
+  if (e->size == e->max) {
+    int max = (e->max == 0 ? 64 : 2 * e->max);
+    INSTRUCTION_T *code_new = (INSTRUCTION_T *) a68_alloc ((size_t) max * sizeof (INSTRUCTION_T), __func__, __LINE__);
+    ABEND (code_new == NO_INSTRUCTION, ERROR_OUT_OF_CORE, __func__);
+    if (e->code != NO_INSTRUCTION) {
+      memcpy (code_new, e->code, (size_t) e->size * sizeof (INSTRUCTION_T));
+      a68_free (e->code);
+    }
+    e->code = code_new;
+    e->max = max;
+  }
+  INSTRUCTION_T *z = &(e->code[e->size]);
+  z->code = code;
+  z->label = NULL;
+  z->node = node;
+  z->aux = aux;
+  z->arg.i = 0;
+  e->depth += effect;
+  if (e->depth > e->max_depth) {
+    e->max_depth = e->depth;
+  }
+  if (e->max_depth > BYTECODE_DEPTH) {
+    e->failed = A68_TRUE;
+  }
+  return e->size++;
+}
+
+//! @brief Whether the propagator of "p" has not been selected yet.
+
+static BOOL_T is_pending (NODE_T * p)
+{
+  PROP_PROC *f = UNIT (&GPROP (p));
+  return (BOOL_T) (f == genie_unit || f == genie_formula || f == genie_coercion);
+}
+
+//! @brief Evaluate "p" through its propagator and take its value.
+
+static void lower_call (EMITTER_T * e, NODE_T * p, MOID_T * m)
+{
+  if (is_pending (p)) {
+    e->pending = A68_TRUE;
+  }
+  e->calls++;
+  if (m == M_INT) {
+    (void) emit (e, BC_CALL_INT, p, NO_NODE, 1);
+  } else if (m == M_REAL) {
+    (void) emit (e, BC_CALL_REAL, p, NO_NODE, 1);
+  } else {
+    (void) emit (e, BC_CALL_BOOL, p, NO_NODE, 1);
+  }
+}
+
+//! @brief Lower scalar unit "p" of mode "m".
+
+static void lower_expression (EMITTER_T * e, NODE_T * p, MOID_T * m)
+{
+  PROP_T *q = &GPROP (p);
+  PROP_PROC *f = UNIT (q);
+  NODE_T *s = SOURCE (q);
+  if (f == genie_constant && MOID (s) == m) {
+    if (m == M_INT) {
+      int k = emit (e, BC_PUSH_INT, s, NO_NODE, 1);
+      e->code[k].arg.i = VALUE ((A68_INT *) CONSTANT (GINFO (s)));
+    } else if (m == M_REAL) {
+      int k = emit (e, BC_PUSH_REAL, s, NO_NODE, 1);
+      e->code[k].arg.r = VALUE ((A68_REAL *) CONSTANT (GINFO (s)));
+    } else {
+      int k = emit (e, BC_PUSH_BOOL, s, NO_NODE, 1);
+      e->code[k].arg.i = VALUE ((A68_BOOL *) CONSTANT (GINFO (s)));
+    }
+  } else if (f == genie_frame_identifier && MOID (s) == m) {
+    (void) emit (e, (m == M_INT ? BC_LOAD_INT : m == M_REAL ? BC_LOAD_REAL : BC_LOAD_BOOL), s, NO_NODE, 1);
+  } else if (f == genie_dereference_loc_int) {
+    (void) emit (e, BC_DEREF_LOC_INT, s, NO_NODE, 1);
+  } else if (f == genie_dereference_loc_real) {
+    (void) emit (e, BC_DEREF_LOC_REAL, s, NO_NODE, 1);
+  } else if (f == genie_dereference_frame_identifier && SUB_MOID (s) == m) {
+    (void) emit (e, (m == M_INT ? BC_DEREF_INT : m == M_REAL ? BC_DEREF_REAL : BC_DEREF_BOOL), s, NO_NODE, 1);
+  } else if (f == genie_widen_int_to_real) {
+    lower_expression (e, SUB (s), M_INT);
+    (void) emit (e, BC_WIDEN, s, NO_NODE, 0);
+  } else if (IS (s, FORMULA) && !is_pending (p)) {
+// A standard dyadic operator, through genie_dyadic_quick or a fused propagator.
+    NODE_T *u = SUB (s), *op = NEXT (u);
+    NODE_T *v = (op != NO_NODE ? NEXT (op) : NO_NODE);
+    GPROC *proc = (op != NO_NODE ? PROCEDURE (TAX (op)) : NO_GPROC);
+    int code = BC_NOP;
+    if (proc != NO_GPROC && MOID (u) == MOID (v)) {
+      if (MOID (u) == M_INT) {
+        code = bytecode_operator (bytecode_int_dyadics, proc);
+      } else if (MOID (u) == M_REAL) {
+        code = bytecode_operator (bytecode_real_dyadics, proc);
+      } else if (MOID (u) == M_BOOL) {
+        code = bytecode_operator (bytecode_bool_dyadics, proc);
+      }
+    }
+    if (code != BC_NOP) {
+      lower_expression (e, u, MOID (u));
+      lower_expression (e, v, MOID (v));
+      (void) emit (e, code, op, NO_NODE, -1);
+    } else {
+      lower_call (e, p, m);
+    }
+  } else if (f == genie_monadic && IS (s, MONADIC_FORMULA)) {
+    NODE_T *op = SUB (s), *u = NEXT (op);
+    GPROC *proc = PROCEDURE (TAX (op));
+    if (proc == genie_minus_int && MOID (u) == M_INT) {
+      lower_expression (e, u, M_INT);
+      (void) emit (e, BC_MINUS_INT, op, NO_NODE, 0);
+    } else if (proc == genie_minus_real && MOID (u) == M_REAL) {
+      lower_expression (e, u, M_REAL);
+      (void) emit (e, BC_MINUS_REAL, op, NO_NODE, 0);
+    } else if (proc == genie_not_bool && MOID (u) == M_BOOL) {
+      lower_expression (e, u, M_BOOL);
+      (void) emit (e, BC_NOT_BOOL, op, NO_NODE, 0);
+    } else {
+      lower_call (e, p, m);
+    }
+  } else {
+    lower_call (e, p, m);
+  }
+}
+
+static void lower_statement (EMITTER_T *, NODE_T *);
+
+//! @brief Lower a serial clause without labels or declarations.
+
+static void lower_serial (EMITTER_T * e, NODE_T * p)
+{
+// Collection is only needed when some unit runs through its propagator.
+  int gc = emit (e, BC_GC, p, NO_NODE, 0), calls = e->calls;
+  BOOL_T linear = STATUS_TEST (p, OPTIMAL_MASK);
+  if (!linear && STATUS_TEST (p, SERIAL_MASK)) {
+    linear = A68_TRUE;
+    for (NODE_T *q = SEQUENCE (p); q != NO_NODE; q = SEQUENCE (q)) {
+      if (IS (q, DECLARATION_LIST)) {
+        linear = A68_FALSE;
+      }
+    }
+  }
+  if (STATUS_TEST (p, OPTIMAL_MASK)) {
+    lower_statement (e, SEQUENCE (p));
+  } else if (linear) {
+    for (NODE_T *q = SEQUENCE (p); q != NO_NODE; q = SEQUENCE (q)) {
+      if (IS (q, UNIT)) {
+        lower_statement (e, q);
+      }
+      if (SEQUENCE (q) != NO_NODE) {
+        q = SEQUENCE (q);
+      }
+    }
+  } else {
+// Declarations, labels, or not run yet; the clause runs as a whole.
+    if (LABELS (TABLE (p)) == NO_TAG && !STATUS_TEST (p, SEQUENCE_MASK)) {
+      e->pending = A68_TRUE;
+    }
+    e->calls++;
+    (void) emit (e, BC_SERIAL, p, NO_NODE, 0);
+  }
+  if (e->calls == calls) {
+    e->code[gc].code = BC_NOP;
+  }
+}
+
+//! @brief Lower a VOID conditional clause without ELIF.
+
+static void lower_conditional (EMITTER_T * e, NODE_T * p)
+{
+  NODE_T *q = SUB (p);
+  if (MOID (q) != M_VOID || !STATUS_TEST (NEXT_SUB (q), OPTIMAL_MASK)) {
+    e->failed = A68_TRUE;
+    return;
+  }
+  NODE_T *if_range = SUB (q), *enquiry = SEQUENCE (NEXT_SUB (q));
+  if (MOID (enquiry) != M_BOOL) {
+    e->failed = A68_TRUE;
+    return;
+  }
+  int calls = e->calls;
+  int open_if = emit (e, BC_FRAME_OPEN, if_range, NO_NODE, 0);
+  lower_expression (e, enquiry, M_BOOL);
+  int jump_false = emit (e, BC_JUMP_FALSE, q, NO_NODE, -1);
+// THEN.
+  FORWARD (q);
+  int calls_then = e->calls;
+  int open_then = emit (e, BC_FRAME_OPEN, SUB (q), NO_NODE, 0);
+  lower_serial (e, NEXT_SUB (q));
+  if (e->calls == calls_then && is_frameless (SUB (q))) {
+    e->code[open_then].code = BC_NOP;
+  } else {
+    (void) emit (e, BC_FRAME_CLOSE, q, NO_NODE, 0);
+  }
+// ELSE.
+  FORWARD (q);
+  if (IS (q, CHOICE) || IS (q, ELSE_PART)) {
+    int jump_end = emit (e, BC_JUMP, q, NO_NODE, 0);
+    e->code[jump_false].arg.target = e->size;
+    int calls_else = e->calls;
+    int open_else = emit (e, BC_FRAME_OPEN, SUB (q), NO_NODE, 0);
+    lower_serial (e, NEXT_SUB (q));
+    if (e->calls == calls_else && is_frameless (SUB (q))) {
+      e->code[open_else].code = BC_NOP;
+    } else {
+      (void) emit (e, BC_FRAME_CLOSE, q, NO_NODE, 0);
+    }
+    e->code[jump_end].arg.target = e->size;
+  } else if (IS (q, CLOSE_SYMBOL) || IS (q, FI_SYMBOL)) {
+    e->code[jump_false].arg.target = e->size;
+  } else {
+// ELIF is left to the tree walker.
+    e->failed = A68_TRUE;
+    return;
+  }
+// FI.
+  if (e->calls == calls && is_frameless (if_range)) {
+    e->code[open_if].code = BC_NOP;
+  } else {
+    (void) emit (e, BC_FRAME_CLOSE, q, NO_NODE, 0);
+  }
+}
+
+//! @brief Lower a counting loop [FOR ...] [FROM ...] [BY ...] [TO ...] DO ... OD.
+
+static void lower_loop (EMITTER_T * e, NODE_T * p)
+{
+  NODE_T *for_part = NO_NODE, *to_part = NO_NODE;
+  if (IS (p, FOR_PART)) {
+    for_part = NEXT_SUB (p);
+    FORWARD (p);
+  }
+  if (IS (p, FROM_PART)) {
+    lower_expression (e, NEXT_SUB (p), M_INT);
+    FORWARD (p);
+  } else {
+    int k = emit (e, BC_PUSH_INT, p, NO_NODE, 1);
+    e->code[k].arg.i = 1;
+  }
+  if (IS (p, BY_PART)) {
+    lower_expression (e, NEXT_SUB (p), M_INT);
+    FORWARD (p);
+  } else {
+    int k = emit (e, BC_PUSH_INT, p, NO_NODE, 1);
+    e->code[k].arg.i = 1;
+  }
+  if (IS (p, TO_PART)) {
+    if (IS (SUB (p), DOWNTO_SYMBOL)) {
+      (void) emit (e, BC_MINUS_INT, p, NO_NODE, 0);
+    }
+    lower_expression (e, NEXT_SUB (p), M_INT);
+    to_part = p;
+    FORWARD (p);
+  } else {
+    (void) emit (e, BC_LOOP_TO, p, NO_NODE, 1);
+  }
+// Only DO ... OD; WHILE and UNTIL are left to the tree walker.
+  if (!(IS (p, DO_PART) || IS (p, ALT_DO_PART)) || !IS (NEXT_SUB (p), SERIAL_CLAUSE) || (NEXT (NEXT_SUB (p)) != NO_NODE && IS (NEXT (NEXT_SUB (p)), UNTIL_PART))) {
+    e->failed = A68_TRUE;
+    return;
+  }
+// The loop frame may hold the loop identifier and nothing else, so it needs no
+// clearing between iterations.
+  NODE_T *q = NEXT_SUB (p);
+  TABLE_T *t = TABLE (q);
+  TAG_T *ids = IDENTIFIERS (t);
+  if (OPERATORS (t) != NO_TAG || ANONYMOUS (t) != NO_TAG || INITIALISE_FRAME (t)) {
+    e->failed = A68_TRUE;
+    return;
+  }
+  if (!(ids == NO_TAG || (for_part != NO_NODE && ids == TAX (for_part) && NEXT (ids) == NO_TAG))) {
+    e->failed = A68_TRUE;
+    return;
+  }
+  (void) emit (e, BC_FRAME_OPEN, q, NO_NODE, 0);
+  int test = emit (e, BC_LOOP_TEST, p, NO_NODE, 0);
+  if (e->resume < 0) {
+    e->resume = test;
+  }
+  int top = e->size;
+  if (for_part != NO_NODE) {
+    (void) emit (e, BC_LOOP_SET, for_part, for_part, 0);
+  }
+  lower_serial (e, q);
+  int next = emit (e, BC_LOOP_NEXT, p, (for_part != NO_NODE || to_part != NO_NODE ? p : NO_NODE), 0);
+  e->code[next].arg.target = top;
+  e->code[test].arg.target = e->size;
+  (void) emit (e, BC_LOOP_END, p, NO_NODE, -3);
+}
+
+//! @brief Lower OP AND BECOMES on a name held by an identifier, or fail.
+
+static BOOL_T lower_becomes (EMITTER_T * e, NODE_T * p)
+{
+  if (!IS (p, FORMULA) || is_pending (p)) {
+    return A68_FALSE;
+  }
+  NODE_T *u = SUB (p), *op = NEXT (u);
+  if (op == NO_NODE || UNIT (&GPROP (u)) != genie_frame_identifier) {
+    return A68_FALSE;
+  }
+  NODE_T *v = NEXT (op);
+  int code = BC_NOP;
+  if (MOID (u) == M_REF_INT && MOID (v) == M_INT) {
+    code = bytecode_operator (bytecode_int_becomes, PROCEDURE (TAX (op)));
+  } else if (MOID (u) == M_REF_REAL && MOID (v) == M_REAL) {
+    code = bytecode_operator (bytecode_real_becomes, PROCEDURE (TAX (op)));
+  }
+  if (code == BC_NOP) {
+    return A68_FALSE;
+  }
+  lower_expression (e, v, MOID (v));
+  (void) emit (e, code, op, SOURCE (&GPROP (u)), -1);
+  return A68_TRUE;
+}
+
+//! @brief Lower an assignation of a scalar to a name held by an identifier, or fail.
+
+static BOOL_T lower_assignation (EMITTER_T * e, NODE_T * p)
+{
+  NODE_T *dst = SUB (p), *src = NEXT_NEXT (dst);
+  MOID_T *m = SUB_MOID (dst);
+  if (!is_bytecode_mode (m) || UNIT (&GPROP (dst)) != genie_frame_identifier) {
+    return A68_FALSE;
+  }
+// The name is checked before the source is evaluated, as the tree walker does.
+// A source that calls out could set the dynamic scope, so it is not lowered.
+  int size = e->size, calls = e->calls;
+  BOOL_T pending = e->pending;
+  (void) emit (e, BC_NAME, p, SOURCE (&GPROP (dst)), 1);
+  lower_expression (e, src, m);
+  if (e->calls != calls) {
+    e->size = size;
+    e->calls = calls;
+    e->pending = pending;
+    e->depth--;
+    return A68_FALSE;
+  }
+  (void) emit (e, (m == M_INT ? BC_STORE_INT : m == M_REAL ? BC_STORE_REAL : BC_STORE_BOOL), p, NO_NODE, -2);
+  return A68_TRUE;
+}
+
+//! @brief Lower statement "p", a unit in a serial clause.
+
+static void lower_statement (EMITTER_T * e, NODE_T * p)
+{
+  PROP_T *q = &GPROP (p);
+  if (UNIT (q) == genie_bytecode) {
+    q = &PROP (BYTECODE (GINFO (p)));
+  }
+  PROP_PROC *f = UNIT (q);
+  NODE_T *s = SOURCE (q);
+  int size = e->size, depth = e->depth;
+  if (f == (PROP_PROC *) genie_conditional) {
+    (void) emit (e, BC_TRACE, p, NO_NODE, 0);
+    lower_conditional (e, s);
+    return;
+  } else if (f == (PROP_PROC *) genie_loop) {
+    (void) emit (e, BC_TRACE, p, NO_NODE, 0);
+    lower_loop (e, s);
+    return;
+  } else if (f == genie_voiding_assignation_identifier) {
+    (void) emit (e, BC_TRACE, p, NO_NODE, 0);
+    if (lower_assignation (e, s)) {
+      return;
+    }
+  } else if (f == genie_voiding && IS (s, VOIDING)) {
+    PROP_T *r = &GPROP (SUB (s));
+    (void) emit (e, BC_TRACE, p, NO_NODE, 0);
+    if (lower_becomes (e, SOURCE (r))) {
+      return;
+    }
+  }
+// Anything else runs through its propagator.
+  e->size = size;
+  e->depth = depth;
+  if (is_pending (p)) {
+    e->pending = A68_TRUE;
+  }
+  e->calls++;
+  (void) emit (e, BC_EXEC, p, NO_NODE, 0);
+}
+
+//! @brief Drop NOP instructions and retarget jumps.
+
+static void compact (EMITTER_T * e)
+{
+  int *map = (int *) a68_alloc ((size_t) (e->size + 1) * sizeof (int), __func__, __LINE__);
+  ABEND (map == NO_INT, ERROR_OUT_OF_CORE, __func__);
+  int n = 0;
+  for (int k = 0; k < e->size; k++) {
+    map[k] = n;
+    if (e->code[k].code != BC_NOP) {
+      n++;
+    }
+  }
+  map[e->size] = n;
+  if (e->resume >= 0) {
+    e->resume = map[e->resume];
+  }
+  n = 0;
+  for (int k = 0; k < e->size; k++) {
+    INSTRUCTION_T *z = &(e->code[k]);
+    if (z->code == BC_JUMP || z->code == BC_JUMP_FALSE || z->code == BC_LOOP_TEST || z->code == BC_LOOP_NEXT) {
+      z->arg.target = map[z->arg.target];
+    }
+    if (z->code != BC_NOP) {
+      e->code[n++] = *z;
+    }
+  }
+  e->size = n;
+  a68_free (map);
+}
+
+//! @brief Lower the statement that "b" belongs to.
+
+static void lower_bytecode (BYTECODE_T * b, NODE_T * p)
+{
+  EMITTER_T e;
+  e.code = NO_INSTRUCTION;
+  e.size = e.max = e.depth = e.max_depth = e.calls = 0;
+  e.resume = -1;
+  e.pending = e.failed = A68_FALSE;
+  if (UNIT (&PROP (b)) == (PROP_PROC *) genie_conditional) {
+    lower_conditional (&e, SOURCE (&PROP (b)));
+  } else {
+    lower_loop (&e, SOURCE (&PROP (b)));
+  }
+  (void) emit (&e, BC_END, p, NO_NODE, 0);
+// Wait for parts that have not run yet, but not for ever.
+  if (e.failed || (e.pending && b->count < BYTECODE_PATIENCE)) {
+    a68_free (e.code);
+    return;
+  }
+  compact (&e);
+  b->code = e.code;
+  b->size = e.size;
+  b->resume = e.resume;
+}
+
+//! @brief Run serial clause "p" as the tree walker does.
+
+static void bytecode_serial (NODE_T * p)
+{
+  ADDR_T pop_sp = A68_SP;
+  jmp_buf exit_buf;
+  genie_preemptive_gc_heap (p);
+  if (!setjmp (exit_buf)) {
+    genie_serial_clause (p, (jmp_buf *) exit_buf);
+  }
+  A68_SP = pop_sp;
+}
+
+//! @brief Run threaded code from instruction "entry" with "n" values on the stack.
+
+static void run_bytecode (BYTECODE_T * b, int entry, BC_VALUE_T * args, int n)
+{
+#if defined (__GNUC__)
+  static void *labels[BC_OPCODES] = {
+    &&L_BC_NOP, &&L_BC_END, &&L_BC_TRACE, &&L_BC_EXEC, &&L_BC_SERIAL, &&L_BC_GC,
+    &&L_BC_CALL_INT, &&L_BC_CALL_REAL, &&L_BC_CALL_BOOL,
+    &&L_BC_PUSH_INT, &&L_BC_PUSH_REAL, &&L_BC_PUSH_BOOL,
+    &&L_BC_LOAD_INT, &&L_BC_LOAD_REAL, &&L_BC_LOAD_BOOL,
+    &&L_BC_DEREF_LOC_INT, &&L_BC_DEREF_LOC_REAL,
+    &&L_BC_DEREF_INT, &&L_BC_DEREF_REAL, &&L_BC_DEREF_BOOL,
+    &&L_BC_WIDEN, &&L_BC_MINUS_INT, &&L_BC_MINUS_REAL, &&L_BC_NOT_BOOL,
+    &&L_BC_ADD_INT, &&L_BC_SUB_INT, &&L_BC_MUL_INT, &&L_BC_OVER_INT, &&L_BC_MOD_INT,
+    &&L_BC_EQ_INT, &&L_BC_NE_INT, &&L_BC_LT_INT, &&L_BC_GT_INT, &&L_BC_LE_INT, &&L_BC_GE_INT,
+    &&L_BC_ADD_REAL, &&L_BC_SUB_REAL, &&L_BC_MUL_REAL, &&L_BC_DIV_REAL,
+    &&L_BC_EQ_REAL, &&L_BC_NE_REAL, &&L_BC_LT_REAL, &&L_BC_GT_REAL, &&L_BC_LE_REAL, &&L_BC_GE_REAL,
+    &&L_BC_EQ_BOOL, &&L_BC_NE_BOOL,
+    &&L_BC_NAME, &&L_BC_STORE_INT, &&L_BC_STORE_REAL, &&L_BC_STORE_BOOL,
+    &&L_BC_PLUSAB_INT, &&L_BC_MINUSAB_INT, &&L_BC_TIMESAB_INT,
+    &&L_BC_PLUSAB_REAL, &&L_BC_MINUSAB_REAL, &&L_BC_TIMESAB_REAL,
+    &&L_BC_JUMP, &&L_BC_JUMP_FALSE, &&L_BC_FRAME_OPEN, &&L_BC_FRAME_CLOSE,
+    &&L_BC_LOOP_TO, &&L_BC_LOOP_TEST, &&L_BC_LOOP_SET, &&L_BC_LOOP_NEXT, &&L_BC_LOOP_END
+  };
+  if (!b->threaded) {
+    for (int k = 0; k < b->size; k++) {
+      b->code[k].label = labels[b->code[k].code];
+    }
+    b->threaded = A68_TRUE;
+  }
+#define OPCODE(n) L_##n:
+#define DISPATCH goto *(pc->label)
+#else
+#define OPCODE(n) case n:
+#define DISPATCH continue
+#endif
+#define STEP {pc++; DISPATCH;}
+#define BRANCH(k) {pc = &(b->code[k]); DISPATCH;}
+  BC_VALUE_T stack[BYTECODE_DEPTH], *sp = stack;
+  INSTRUCTION_T *pc = &(b->code[entry]);
+  for (int k = 0; k < n; k++) {
+    *(sp++) = args[k];
+  }
+#if defined (__GNUC__)
+  DISPATCH;
+#else
+  for (;;) {
+    switch (pc->code) {
+#endif
+  OPCODE (BC_NOP) {
+      STEP;
+    }
+  OPCODE (BC_END) {
+      return;
+    }
+  OPCODE (BC_TRACE) {
+      NODE_T *u = pc->node;
+      if (STATUS_TEST (u, (BREAKPOINT_MASK | BREAKPOINT_TEMPORARY_MASK | BREAKPOINT_INTERRUPT_MASK | BREAKPOINT_WATCH_MASK | BREAKPOINT_TRACE_MASK))) {
+        single_step (u, STATUS (u));
+      }
+      STEP;
+    }
+  OPCODE (BC_EXEC) {
+      ADDR_T pop_sp = A68_SP;
+      GENIE_UNIT_TRACE (pc->node);
+      A68_SP = pop_sp;
+      STEP;
+    }
+  OPCODE (BC_SERIAL) {
+      bytecode_serial (pc->node);
+      STEP;
+    }
+  OPCODE (BC_GC) {
+      genie_preemptive_gc_heap (pc->node);
+      STEP;
+    }
+  OPCODE (BC_CALL_INT) {
+      A68_INT z;
+      GENIE_UNIT (pc->node);
+      POP_OBJECT (pc->node, &z, A68_INT);
+      (sp++)->i = VALUE (&z);
+      STEP;
+    }
+  OPCODE (BC_CALL_REAL) {
+      A68_REAL z;
+      GENIE_UNIT (pc->node);
+      POP_OBJECT (pc->node, &z, A68_REAL);
+      (sp++)->r = VALUE (&z);
+      STEP;
+    }
+  OPCODE (BC_CALL_BOOL) {
+      A68_BOOL z;
+      GENIE_UNIT (pc->node);
+      POP_OBJECT (pc->node, &z, A68_BOOL);
+      (sp++)->b = VALUE (&z);
+      STEP;
+    }
+  OPCODE (BC_PUSH_INT) {
+      (sp++)->i = pc->arg.i;
+      STEP;
+    }
+  OPCODE (BC_PUSH_REAL) {
+      (sp++)->r = pc->arg.r;
+      STEP;
+    }
+  OPCODE (BC_PUSH_BOOL) {
+      (sp++)->b = (BOOL_T) pc->arg.i;
+      STEP;
+    }
+  OPCODE (BC_LOAD_INT) {
+      A68_INT *z;
+      FRAME_GET (z, A68_INT, pc->node);
+      (sp++)->i = VALUE (z);
+      STEP;
+    }
+  OPCODE (BC_LOAD_REAL) {
+      A68_REAL *z;
+      FRAME_GET (z, A68_REAL, pc->node);
+      (sp++)->r = VALUE (z);
+      STEP;
+    }
+  OPCODE (BC_LOAD_BOOL) {
+      A68_BOOL *z;
+      FRAME_GET (z, A68_BOOL, pc->node);
+      (sp++)->b = VALUE (z);
+      STEP;
+    }
+  OPCODE (BC_DEREF_LOC_INT) {
+      A68_REF *z;
+      FRAME_GET (z, A68_REF, pc->node);
+      (sp++)->i = VALUE (DEREF (A68_INT, z));
+      STEP;
+    }
+  OPCODE (BC_DEREF_LOC_REAL) {
+      A68_REF *z;
+      FRAME_GET (z, A68_REF, pc->node);
+      (sp++)->r = VALUE (DEREF (A68_REAL, z));
+      STEP;
+    }
+  OPCODE (BC_DEREF_INT) {
+      A68_REF *z;
+      FRAME_GET (z, A68_REF, pc->node);
+      A68_INT *x = DEREF (A68_INT, z);
+      CHECK_INIT (pc->node, INITIALISED (x), M_INT);
+      (sp++)->i = VALUE (x);
+      STEP;
+    }
+  OPCODE (BC_DEREF_REAL) {
+      A68_REF *z;
+      FRAME_GET (z, A68_REF, pc->node);
+      A68_REAL *x = DEREF (A68_REAL, z);
+      CHECK_INIT (pc->node, INITIALISED (x), M_REAL);
+      (sp++)->r = VALUE (x);
+      STEP;
+    }
+  OPCODE (BC_DEREF_BOOL) {
+      A68_REF *z;
+      FRAME_GET (z, A68_REF, pc->node);
+      A68_BOOL *x = DEREF (A68_BOOL, z);
+      CHECK_INIT (pc->node, INITIALISED (x), M_BOOL);
+      (sp++)->b = VALUE (x);
+      STEP;
+    }
+  OPCODE (BC_WIDEN) {
+      sp[-1].r = (REAL_T) sp[-1].i;
+      STEP;
+    }
+  OPCODE (BC_MINUS_INT) {
+      sp[-1].i = -sp[-1].i;
+      STEP;
+    }
+  OPCODE (BC_MINUS_REAL) {
+      sp[-1].r = -sp[-1].r;
+      STEP;
+    }
+  OPCODE (BC_NOT_BOOL) {
+      sp[-1].b = (BOOL_T) ! sp[-1].b;
+      STEP;
+    }
+#define BC_INT_DYADIC(f, t) {\
+      sp--;\
+      errno = 0;\
+      sp[-1].i = f (sp[-1].i, sp[0].i);\
+      MATH_RTE (pc->node, errno != 0, M_INT, t);\
+      STEP;\
+    }
+  OPCODE (BC_ADD_INT) BC_INT_DYADIC (a68_add_int, "M overflow");
+  OPCODE (BC_SUB_INT) BC_INT_DYADIC (a68_sub_int, "M overflow");
+  OPCODE (BC_MUL_INT) BC_INT_DYADIC (a68_mul_int, "M overflow");
+  OPCODE (BC_OVER_INT) BC_INT_DYADIC (a68_over_int, ERROR_DIVISION_BY_ZERO);
+  OPCODE (BC_MOD_INT) BC_INT_DYADIC (a68_mod_int, ERROR_DIVISION_BY_ZERO);
+#undef BC_INT_DYADIC
+#define BC_COMPARE(u, OP) {\
+      sp--;\
+      sp[-1].b = (BOOL_T) (sp[-1].u OP sp[0].u);\
+      STEP;\
+    }
+  OPCODE (BC_EQ_INT) BC_COMPARE (i, ==);
+  OPCODE (BC_NE_INT) BC_COMPARE (i, !=);
+  OPCODE (BC_LT_INT) BC_COMPARE (i, <);
+  OPCODE (BC_GT_INT) BC_COMPARE (i, >);
+  OPCODE (BC_LE_INT) BC_COMPARE (i, <=);
+  OPCODE (BC_GE_INT) BC_COMPARE (i, >=);
+  OPCODE (BC_EQ_REAL) BC_COMPARE (r, ==);
+  OPCODE (BC_NE_REAL) BC_COMPARE (r, !=);
+  OPCODE (BC_LT_REAL) BC_COMPARE (r, <);
+  OPCODE (BC_GT_REAL) BC_COMPARE (r, >);
+  OPCODE (BC_LE_REAL) BC_COMPARE (r, <=);
+  OPCODE (BC_GE_REAL) BC_COMPARE (r, >=);
+  OPCODE (BC_EQ_BOOL) BC_COMPARE (b, ==);
+  OPCODE (BC_NE_BOOL) BC_COMPARE (b, !=);
+#undef BC_COMPARE
+#define BC_REAL_DYADIC(OP) {\
+      sp--;\
+      sp[-1].r = sp[-1].r OP sp[0].r;\
+      CHECK_REAL (pc->node, sp[-1].r);\
+      STEP;\
+    }
+  OPCODE (BC_ADD_REAL) BC_REAL_DYADIC (+);
+  OPCODE (BC_SUB_REAL) BC_REAL_DYADIC (-);
+  OPCODE (BC_MUL_REAL) BC_REAL_DYADIC (*);
+#undef BC_REAL_DYADIC
+  OPCODE (BC_DIV_REAL) {
+      sp--;
+      PRELUDE_ERROR (sp[0].r == 0.0, pc->node, ERROR_DIVISION_BY_ZERO, M_REAL);
+      sp[-1].r /= sp[0].r;
+      STEP;
+    }
+  OPCODE (BC_NAME) {
+      A68_REF *z;
+      FRAME_GET (z, A68_REF, pc->aux);
+      CHECK_REF (pc->node, *z, MOID (pc->node));
+      (sp++)->a = ADDRESS (z);
+      STEP;
+    }
+  OPCODE (BC_STORE_INT) {
+      A68_INT *z = (A68_INT *) sp[-2].a;
+      STATUS (z) = INIT_MASK;
+      VALUE (z) = sp[-1].i;
+      sp -= 2;
+      STEP;
+    }
+  OPCODE (BC_STORE_REAL) {
+      A68_REAL *z = (A68_REAL *) sp[-2].a;
+      STATUS (z) = INIT_MASK;
+      VALUE (z) = sp[-1].r;
+      sp -= 2;
+      STEP;
+    }
+  OPCODE (BC_STORE_BOOL) {
+      A68_BOOL *z = (A68_BOOL *) sp[-2].a;
+      STATUS (z) = INIT_MASK;
+      VALUE (z) = sp[-1].b;
+      sp -= 2;
+      STEP;
+    }
+#define BC_INT_BECOMES(f) {\
+      A68_REF *z;\
+      FRAME_GET (z, A68_REF, pc->aux);\
+      CHECK_REF (pc->node, *z, M_REF_INT);\
+      A68_INT *x = DEREF (A68_INT, z);\
+      CHECK_INIT (pc->node, INITIALISED (x), M_INT);\
+      errno = 0;\
+      INT_T k = f (VALUE (x), (--sp)->i);\
+      MATH_RTE (pc->node, errno != 0, M_INT, "M overflow");\
+      VALUE (x) = k;\
+      STEP;\
+    }
+  OPCODE (BC_PLUSAB_INT) BC_INT_BECOMES (a68_add_int);
+  OPCODE (BC_MINUSAB_INT) BC_INT_BECOMES (a68_sub_int);
+  OPCODE (BC_TIMESAB_INT) BC_INT_BECOMES (a68_mul_int);
+#undef BC_INT_BECOMES
+#define BC_REAL_BECOMES(OP) {\
+      A68_REF *z;\
+      FRAME_GET (z, A68_REF, pc->aux);\
+      CHECK_REF (pc->node, *z, M_REF_REAL);\
+      A68_REAL *x = DEREF (A68_REAL, z);\
+      CHECK_INIT (pc->node, INITIALISED (x), M_REAL);\
+      REAL_T w = VALUE (x) OP (--sp)->r;\
+      CHECK_REAL (pc->node, w);\
+      VALUE (x) = w;\
+      STEP;\
+    }
+  OPCODE (BC_PLUSAB_REAL) BC_REAL_BECOMES (+);
+  OPCODE (BC_MINUSAB_REAL) BC_REAL_BECOMES (-);
+  OPCODE (BC_TIMESAB_REAL) BC_REAL_BECOMES (*);
+#undef BC_REAL_BECOMES
+  OPCODE (BC_JUMP) {
+      BRANCH (pc->arg.target);
+    }
+  OPCODE (BC_JUMP_FALSE) {
+      if ((--sp)->b == A68_FALSE) {
+        BRANCH (pc->arg.target);
+      }
+      STEP;
+    }
+  OPCODE (BC_FRAME_OPEN) {
+      OPEN_STATIC_FRAME (pc->node);
+      INIT_GLOBAL_POINTER (pc->node);
+      INIT_STATIC_FRAME (pc->node);
+      STEP;
+    }
+  OPCODE (BC_FRAME_CLOSE) {
+      CLOSE_FRAME;
+      STEP;
+    }
+// The loop keeps counter, step and limit on the stack.
+  OPCODE (BC_LOOP_TO) {
+      sp[0].i = (sp[-1].i >= 0 ? A68_MAX_INT : -A68_MAX_INT);
+      sp++;
+      STEP;
+    }
+  OPCODE (BC_LOOP_TEST) {
+      INT_T counter = sp[-3].i, by = sp[-2].i, to = sp[-1].i;
+      if (!((by > 0 && counter <= to) || (by < 0 && counter >= to) || (by == 0))) {
+        BRANCH (pc->arg.target);
+      }
+      STEP;
+    }
+  OPCODE (BC_LOOP_SET) {
+      A68_INT *z = (A68_INT *) (FRAME_OBJECT (OFFSET (TAX (pc->aux))));
+      STATUS (z) = INIT_MASK;
+      VALUE (z) = sp[-3].i;
+      STEP;
+    }
+  OPCODE (BC_LOOP_NEXT) {
+      INT_T counter = sp[-3].i, by = sp[-2].i, to = sp[-1].i;
+      if (pc->aux != NO_NODE) {
+        CHECK_INT_ADDITION (pc->node, counter, by);
+        counter += by;
+        sp[-3].i = counter;
+      }
+      if ((by > 0 && counter <= to) || (by < 0 && counter >= to) || (by == 0)) {
+        BRANCH (pc->arg.target);
+      }
+      STEP;
+    }
+  OPCODE (BC_LOOP_END) {
+      CLOSE_FRAME;
+      sp -= 3;
+      STEP;
+    }
+#if !defined (__GNUC__)
+    }
+  }
+#endif
+#undef OPCODE
+#undef DISPATCH
+#undef STEP
+#undef BRANCH
+}
+
+//! @brief Propagator for a statement that may run as threaded code.
+
+PROP_T genie_bytecode (NODE_T * p)
+{
+  BYTECODE_T *b = BYTECODE (GINFO (p));
+  if (b->code == NO_INSTRUCTION) {
+    b->count++;
+// Lower on the first run and then at exponentially spaced runs.
+    if ((b->count & (b->count - 1)) == 0 && b->count <= BYTECODE_PATIENCE) {
+      lower_bytecode (b, p);
+    }
+  }
+  if (b->code != NO_INSTRUCTION) {
+    run_bytecode (b, 0, NO_BC_VALUE, 0);
+  } else {
+    (void) (*(UNIT (&PROP (b)))) (SOURCE (&PROP (b)));
+  }
+  return GPROP (p);
+}
+
+//! @brief Bytecode record for "p" that runs "self" until lowered.
+
+static BYTECODE_T *new_bytecode (NODE_T * p, PROP_T * self)
+{
+  BYTECODE_T *b = (BYTECODE_T *) get_fixed_heap_space ((size_t) SIZE_ALIGNED (BYTECODE_T));
+  PROP (b) = *self;
+  b->code = NO_INSTRUCTION;
+  b->size = b->count = 0;
+  b->resume = -1;
+  b->threaded = A68_FALSE;
+  BYTECODE (GINFO (p)) = b;
+  return b;
+}
+
+//! @brief Install genie_bytecode for statement "p" that yielded "self".
+
+void genie_bytecode_candidate (NODE_T * p, PROP_T * self)
+{
+  if (OPTION_PROFILE (&A68_JOB) || MOID (p) != M_VOID || BYTECODE (GINFO (p)) != NO_BYTECODE) {
+    return;
+  }
+  if (UNIT (self) != (PROP_PROC *) genie_conditional && UNIT (self) != (PROP_PROC *) genie_loop) {
+    return;
+  }
+  (void) new_bytecode (p, self);
+  UNIT (self) = genie_bytecode;
+  SOURCE (self) = p;
+}
+
+//! @brief Run the remaining iterations of counting loop "p" as threaded code.
+
+BOOL_T genie_bytecode_loop (NODE_T * p, INT_T counter, INT_T by, INT_T to)
+{
+// A loop that runs only once, like the main loop of a program, is taken over
+// between iterations, with its frame open and its counter on the stack.
+  if (OPTION_PROFILE (&A68_JOB)) {
+    return A68_FALSE;
+  }
+  BYTECODE_T *b = BYTECODE (GINFO (p));
+  if (b == NO_BYTECODE) {
+    PROP_T self;
+    UNIT (&self) = (PROP_PROC *) genie_loop;
+    SOURCE (&self) = p;
+    b = new_bytecode (p, &self);
+  }
+  if (b->code == NO_INSTRUCTION) {
+    if (b->count > BYTECODE_PATIENCE) {
+      return A68_FALSE;
+    }
+    b->count++;
+    if ((b->count & (b->count - 1)) == 0) {
+      lower_bytecode (b, p);
+    }
+    if (b->code == NO_INSTRUCTION) {
+      return A68_FALSE;
+    }
+  }
+  BC_VALUE_T args[3];
+  args[0].i = counter;
+  args[1].i = by;
+  args[2].i = to;
+  run_bytecode (b, b->resume, args, 3);
+  return A68_TRUE;
+}
@@ -156,7 +156,7 @@ void genie_call_procedure (NODE_T * p, MOID_T * p_mode, MOID_T * pproc, MOID_T *
 // Without PARAMETERS.
         entry = NEXT_NEXT (entry);
       }
-      GENIE_UNIT_TRACE (entry);
+      GENIE_ROUTINE_TRACE (body, entry);
       if (A68_FP == A68_MON (finish_frame_pointer)) {
         change_masks (TOP_NODE (&A68_JOB), BREAKPOINT_INTERRUPT_MASK, A68_TRUE);
       }
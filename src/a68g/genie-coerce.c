@@ -311,6 +311,36 @@ PROP_T genie_dereference_frame_identifier (NODE_T * p)
   return GPROP (p);
 }
 
+//! @brief Dereference a LOC variable that is known to hold a value.
+
+PROP_T genie_dereference_loc_identifier (NODE_T * p)
+{
+  A68_REF *z;
+  FRAME_GET (z, A68_REF, p);
+  PUSH (p, ADDRESS (z), SIZE (SUB_MOID (p)));
+  return GPROP (p);
+}
+
+//! @brief Dereference a LOC INT variable that is known to hold a value.
+
+PROP_T genie_dereference_loc_int (NODE_T * p)
+{
+  A68_REF *z;
+  FRAME_GET (z, A68_REF, p);
+  PUSH_VALUE (p, VALUE (DEREF (A68_INT, z)), A68_INT);
+  return GPROP (p);
+}
+
+//! @brief Dereference a LOC REAL variable that is known to hold a value.
+
+PROP_T genie_dereference_loc_real (NODE_T * p)
+{
+  A68_REF *z;
+  FRAME_GET (z, A68_REF, p);
+  PUSH_VALUE (p, VALUE (DEREF (A68_REAL, z)), A68_REAL);
+  return GPROP (p);
+}
+
 //! @brief Dereference an identifier.
 
 PROP_T genie_dereference_generic_identifier (NODE_T * p)
@@ -390,7 +420,15 @@ PROP_T genie_dereferencing (NODE_T * p)
   PUSH (p, ADDRESS (&z), SIZE (MOID (p)));
   genie_check_initialisation (p, STACK_OFFSET (-SIZE (MOID (p))), MOID (p));
   if (UNIT (&self) == genie_frame_identifier) {
-    if (IS_IN_FRAME (&z)) {
+    if (IS_IN_FRAME (&z) && IS_INITIALISED (GINFO (SOURCE (&self)))) {
+      if (MOID (p) == M_INT) {
+        UNIT (&self) = genie_dereference_loc_int;
+      } else if (MOID (p) == M_REAL) {
+        UNIT (&self) = genie_dereference_loc_real;
+      } else {
+        UNIT (&self) = genie_dereference_loc_identifier;
+      }
+    } else if (IS_IN_FRAME (&z)) {
       UNIT (&self) = genie_dereference_frame_identifier;
     } else {
       UNIT (&self) = genie_dereference_generic_identifier;
@@ -439,7 +477,14 @@ PROP_T genie_voiding (NODE_T * p)
   GENIE_UNIT_2 (SUB (p), source);
   A68_SP = sp_for_voiding;
   if (UNIT (&source) == genie_assignation_quick) {
-    UNIT (&self) = genie_voiding_assignation;
+    NODE_T *dst = SUB (SOURCE (&source));
+    MOID_T *m = SUB_MOID (dst);
+    BOOL_T scalar = (m == M_INT || m == M_REAL || m == M_BOOL || m == M_CHAR || m == M_BITS);
+    if (scalar && UNIT (&GPROP (dst)) == genie_frame_identifier) {
+      UNIT (&self) = genie_voiding_assignation_identifier;
+    } else {
+      UNIT (&self) = genie_voiding_assignation;
+    }
     SOURCE (&self) = SOURCE (&source);
   } else if (UNIT (&source) == genie_assignation_constant) {
     UNIT (&self) = genie_voiding_assignation_constant;
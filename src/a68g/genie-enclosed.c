@@ -97,6 +97,9 @@ PROP_T genie_unit (NODE_T * p)
       }
     case UNIT: {
         GENIE_UNIT_2 (SUB (p), GLOBAL_PROP (&A68_JOB));
+        if (OPTION_BYTECODE (&A68_JOB)) {
+          genie_bytecode_candidate (p, &GLOBAL_PROP (&A68_JOB));
+        }
         break;
       }
     case TERTIARY:
@@ -685,7 +688,7 @@ PROP_T genie_loop (volatile NODE_T * p)
   volatile ADDR_T pop_sp = A68_SP;
   volatile INT_T from, by, to, counter;
   volatile BOOL_T siga, conditional;
-  volatile NODE_T *for_part = NO_NODE, *to_part = NO_NODE, *q = NO_NODE;
+  volatile NODE_T *for_part = NO_NODE, *to_part = NO_NODE, *q = NO_NODE, *loop = p;
   jmp_buf exit_buf;
 // FOR  identifier.
   if (IS (p, FOR_PART)) {
@@ -819,6 +822,11 @@ PROP_T genie_loop (volatile NODE_T * p)
         if (INITIALISE_FRAME (TABLE (q))) {
           initialise_frame ((NODE_T *) q);
         }
+// Threaded code can take over from here, and closes the frame.
+        if (OPTION_BYTECODE (&A68_JOB) && genie_bytecode_loop ((NODE_T *) loop, counter, by, to)) {
+          A68_SP = pop_sp;
+          return GPROP ((NODE_T *) loop);
+        }
       }
     }
   }
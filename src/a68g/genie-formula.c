@@ -152,6 +152,269 @@ PROP_T genie_dyadic (NODE_T * p)
   return GPROP (p);
 }
 
+// Superinstructions.
+// A dyadic formula on INT or REAL operands is fused into one propagator that
+// fetches constants, identifiers and dereferenced LOC variables in line and
+// applies the operator in C, so the operands cost no propagator calls and no
+// stack traffic. Other operands are still evaluated through their propagator.
+
+//! @brief Fetch an INT operand.
+
+static inline INT_T fused_int_operand (NODE_T * p)
+{
+  PROP_T *q = &GPROP (p);
+  NODE_T *s = SOURCE (q);
+  if (UNIT (q) == genie_constant) {
+    return VALUE ((A68_INT *) CONSTANT (GINFO (s)));
+  } else if (UNIT (q) == genie_frame_identifier) {
+    A68_INT *z;
+    FRAME_GET (z, A68_INT, s);
+    return VALUE (z);
+  } else if (UNIT (q) == genie_dereference_loc_int) {
+    A68_REF *z;
+    FRAME_GET (z, A68_REF, s);
+    return VALUE (DEREF (A68_INT, z));
+  } else {
+    A68_INT z;
+    GENIE_UNIT (p);
+    POP_OBJECT (p, &z, A68_INT);
+    return VALUE (&z);
+  }
+}
+
+//! @brief Fetch a REAL operand.
+
+static inline REAL_T fused_real_operand (NODE_T * p)
+{
+  PROP_T *q = &GPROP (p);
+  NODE_T *s = SOURCE (q);
+  if (UNIT (q) == genie_constant) {
+    return VALUE ((A68_REAL *) CONSTANT (GINFO (s)));
+  } else if (UNIT (q) == genie_frame_identifier) {
+    A68_REAL *z;
+    FRAME_GET (z, A68_REAL, s);
+    return VALUE (z);
+  } else if (UNIT (q) == genie_dereference_loc_real) {
+    A68_REF *z;
+    FRAME_GET (z, A68_REF, s);
+    return VALUE (DEREF (A68_REAL, z));
+  } else if (UNIT (q) == genie_widen_int_to_real) {
+    return (REAL_T) fused_int_operand (SUB (s));
+  } else {
+    A68_REAL z;
+    GENIE_UNIT (p);
+    POP_OBJECT (p, &z, A68_REAL);
+    return VALUE (&z);
+  }
+}
+
+//! @brief Push the name yielded by the left operand of an OP AND BECOMES.
+
+static inline A68_REF *fused_name_operand (NODE_T * p)
+{
+  PROP_T *q = &GPROP (p);
+  A68_REF *z = (A68_REF *) STACK_TOP;
+  if (UNIT (q) == genie_frame_identifier) {
+    A68_REF *w;
+    FRAME_GET (w, A68_REF, SOURCE (q));
+    PUSH_REF (p, *w);
+  } else {
+    GENIE_UNIT (p);
+    STACK_DNS (p, MOID (p), A68_FP);
+  }
+  return z;
+}
+
+#define A68_FUSED_INT(n, f, t)\
+static PROP_T n (NODE_T * p) {\
+  NODE_T *u = SUB (p), *op = NEXT (u);\
+  INT_T i = fused_int_operand (u);\
+  INT_T j = fused_int_operand (NEXT (op));\
+  errno = 0;\
+  INT_T k = f (i, j);\
+  MATH_RTE (op, errno != 0, M_INT, t);\
+  PUSH_VALUE (p, k, A68_INT);\
+  return GPROP (p);\
+  }
+
+#define A68_FUSED_CMP_INT(n, OP)\
+static PROP_T n (NODE_T * p) {\
+  NODE_T *u = SUB (p), *op = NEXT (u);\
+  INT_T i = fused_int_operand (u);\
+  INT_T j = fused_int_operand (NEXT (op));\
+  PUSH_VALUE (p, (BOOL_T) (i OP j), A68_BOOL);\
+  return GPROP (p);\
+  }
+
+#define A68_FUSED_REAL(n, OP)\
+static PROP_T n (NODE_T * p) {\
+  NODE_T *u = SUB (p), *op = NEXT (u);\
+  REAL_T x = fused_real_operand (u);\
+  REAL_T y = fused_real_operand (NEXT (op));\
+  REAL_T z = x OP y;\
+  CHECK_REAL (op, z);\
+  PUSH_VALUE (p, z, A68_REAL);\
+  return GPROP (p);\
+  }
+
+#define A68_FUSED_CMP_REAL(n, OP)\
+static PROP_T n (NODE_T * p) {\
+  NODE_T *u = SUB (p), *op = NEXT (u);\
+  REAL_T x = fused_real_operand (u);\
+  REAL_T y = fused_real_operand (NEXT (op));\
+  PUSH_VALUE (p, (BOOL_T) (x OP y), A68_BOOL);\
+  return GPROP (p);\
+  }
+
+#define A68_FUSED_INT_AB(n, f, t)\
+static PROP_T n (NODE_T * p) {\
+  NODE_T *u = SUB (p), *op = NEXT (u);\
+  A68_REF *z = fused_name_operand (u);\
+  INT_T j = fused_int_operand (NEXT (op));\
+  CHECK_REF (op, *z, M_REF_INT);\
+  A68_INT *i = DEREF (A68_INT, z);\
+  CHECK_INIT (op, INITIALISED (i), M_INT);\
+  errno = 0;\
+  INT_T k = f (VALUE (i), j);\
+  MATH_RTE (op, errno != 0, M_INT, t);\
+  VALUE (i) = k;\
+  return GPROP (p);\
+  }
+
+#define A68_FUSED_REAL_AB(n, OP)\
+static PROP_T n (NODE_T * p) {\
+  NODE_T *u = SUB (p), *op = NEXT (u);\
+  A68_REF *z = fused_name_operand (u);\
+  REAL_T y = fused_real_operand (NEXT (op));\
+  CHECK_REF (op, *z, M_REF_REAL);\
+  A68_REAL *x = DEREF (A68_REAL, z);\
+  CHECK_INIT (op, INITIALISED (x), M_REAL);\
+  REAL_T w = VALUE (x) OP y;\
+  CHECK_REAL (op, w);\
+  VALUE (x) = w;\
+  return GPROP (p);\
+  }
+
+A68_FUSED_INT (genie_fused_add_int, a68_add_int, "M overflow");
+A68_FUSED_INT (genie_fused_sub_int, a68_sub_int, "M overflow");
+A68_FUSED_INT (genie_fused_mul_int, a68_mul_int, "M overflow");
+A68_FUSED_INT (genie_fused_over_int, a68_over_int, ERROR_DIVISION_BY_ZERO);
+A68_FUSED_INT (genie_fused_mod_int, a68_mod_int, ERROR_DIVISION_BY_ZERO);
+A68_FUSED_CMP_INT (genie_fused_eq_int, ==);
+A68_FUSED_CMP_INT (genie_fused_ne_int, !=);
+A68_FUSED_CMP_INT (genie_fused_lt_int, <);
+A68_FUSED_CMP_INT (genie_fused_gt_int, >);
+A68_FUSED_CMP_INT (genie_fused_le_int, <=);
+A68_FUSED_CMP_INT (genie_fused_ge_int, >=);
+A68_FUSED_REAL (genie_fused_add_real, +);
+A68_FUSED_REAL (genie_fused_sub_real, -);
+A68_FUSED_REAL (genie_fused_mul_real, *);
+A68_FUSED_CMP_REAL (genie_fused_eq_real, ==);
+A68_FUSED_CMP_REAL (genie_fused_ne_real, !=);
+A68_FUSED_CMP_REAL (genie_fused_lt_real, <);
+A68_FUSED_CMP_REAL (genie_fused_gt_real, >);
+A68_FUSED_CMP_REAL (genie_fused_le_real, <=);
+A68_FUSED_CMP_REAL (genie_fused_ge_real, >=);
+A68_FUSED_INT_AB (genie_fused_plusab_int, a68_add_int, "M overflow");
+A68_FUSED_INT_AB (genie_fused_minusab_int, a68_sub_int, "M overflow");
+A68_FUSED_INT_AB (genie_fused_timesab_int, a68_mul_int, "M overflow");
+A68_FUSED_REAL_AB (genie_fused_plusab_real, +);
+A68_FUSED_REAL_AB (genie_fused_minusab_real, -);
+A68_FUSED_REAL_AB (genie_fused_timesab_real, *);
+
+// Standard operators that have a fused counterpart, by operand modes.
+
+typedef struct FUSED_T FUSED_T;
+
+#define NO_FUSED ((FUSED_T *) NULL)
+
+struct FUSED_T
+{
+  GPROC *procedure;
+  PROP_PROC *fused;
+  char *name;
+};
+
+static FUSED_T fused_int[] = {
+  {genie_add_int, genie_fused_add_int, "genie_fused_add_int"},
+  {genie_sub_int, genie_fused_sub_int, "genie_fused_sub_int"},
+  {genie_mul_int, genie_fused_mul_int, "genie_fused_mul_int"},
+  {genie_over_int, genie_fused_over_int, "genie_fused_over_int"},
+  {genie_mod_int, genie_fused_mod_int, "genie_fused_mod_int"},
+  {genie_eq_int, genie_fused_eq_int, "genie_fused_eq_int"},
+  {genie_ne_int, genie_fused_ne_int, "genie_fused_ne_int"},
+  {genie_lt_int, genie_fused_lt_int, "genie_fused_lt_int"},
+  {genie_gt_int, genie_fused_gt_int, "genie_fused_gt_int"},
+  {genie_le_int, genie_fused_le_int, "genie_fused_le_int"},
+  {genie_ge_int, genie_fused_ge_int, "genie_fused_ge_int"},
+  {NO_GPROC, NO_PPROC, NO_TEXT}
+};
+
+static FUSED_T fused_real[] = {
+  {genie_add_real, genie_fused_add_real, "genie_fused_add_real"},
+  {genie_sub_real, genie_fused_sub_real, "genie_fused_sub_real"},
+  {genie_mul_real, genie_fused_mul_real, "genie_fused_mul_real"},
+  {genie_eq_real, genie_fused_eq_real, "genie_fused_eq_real"},
+  {genie_ne_real, genie_fused_ne_real, "genie_fused_ne_real"},
+  {genie_lt_real, genie_fused_lt_real, "genie_fused_lt_real"},
+  {genie_gt_real, genie_fused_gt_real, "genie_fused_gt_real"},
+  {genie_le_real, genie_fused_le_real, "genie_fused_le_real"},
+  {genie_ge_real, genie_fused_ge_real, "genie_fused_ge_real"},
+  {NO_GPROC, NO_PPROC, NO_TEXT}
+};
+
+static FUSED_T fused_int_ab[] = {
+  {genie_plusab_int, genie_fused_plusab_int, "genie_fused_plusab_int"},
+  {genie_minusab_int, genie_fused_minusab_int, "genie_fused_minusab_int"},
+  {genie_timesab_int, genie_fused_timesab_int, "genie_fused_timesab_int"},
+  {NO_GPROC, NO_PPROC, NO_TEXT}
+};
+
+static FUSED_T fused_real_ab[] = {
+  {genie_plusab_real, genie_fused_plusab_real, "genie_fused_plusab_real"},
+  {genie_minusab_real, genie_fused_minusab_real, "genie_fused_minusab_real"},
+  {genie_timesab_real, genie_fused_timesab_real, "genie_fused_timesab_real"},
+  {NO_GPROC, NO_PPROC, NO_TEXT}
+};
+
+static FUSED_T *fused_tables[] = {fused_int, fused_real, fused_int_ab, fused_real_ab, NO_FUSED};
+
+//! @brief Fused propagator for standard operator "proc" on "u" and "v", if any.
+
+static PROP_PROC *fused_dyadic (GPROC * proc, MOID_T * u, MOID_T * v)
+{
+  FUSED_T *t = NO_FUSED;
+  if (u == M_INT && v == M_INT) {
+    t = fused_int;
+  } else if (u == M_REAL && v == M_REAL) {
+    t = fused_real;
+  } else if (u == M_REF_INT && v == M_INT) {
+    t = fused_int_ab;
+  } else if (u == M_REF_REAL && v == M_REAL) {
+    t = fused_real_ab;
+  }
+  for (; t != NO_FUSED && PROCEDURE (t) != NO_GPROC; t++) {
+    if (PROCEDURE (t) == proc) {
+      return FUSED (t);
+    }
+  }
+  return NO_PPROC;
+}
+
+//! @brief Name of a fused propagator, for diagnostics.
+
+char *fused_propagator_name (const PROP_PROC * p)
+{
+  for (int k = 0; fused_tables[k] != NO_FUSED; k++) {
+    for (FUSED_T *t = fused_tables[k]; PROCEDURE (t) != NO_GPROC; t++) {
+      if (FUSED (t) == p) {
+        return NAME (t);
+      }
+    }
+  }
+  return NO_TEXT;
+}
+
 //! @brief Push result of formula.
 
 PROP_T genie_formula (NODE_T * p)
@@ -172,7 +435,8 @@ PROP_T genie_formula (NODE_T * p)
     UNIT (&self) = genie_dyadic;
     if (proc != NO_GPROC) {
       (void) ((*(proc)) (op));
-      UNIT (&self) = genie_dyadic_quick;
+      PROP_PROC *fused = fused_dyadic (proc, MOID (u), MOID (v));
+      UNIT (&self) = (fused != NO_PPROC ? fused : genie_dyadic_quick);
     } else {
       genie_call_operator (op, pop_sp);
     }
@@ -22,6 +22,8 @@
 //! @section Synopsis
 //!
 //! Low-level regular expression routines.
+//! Compiled patterns are kept in a small LRU cache, so a pattern that is
+//! applied in a loop is compiled only once.
 
 #include "a68g.h"
 #include "a68g-genie.h"
@@ -52,33 +54,101 @@ static void push_grep_ret (NODE_T * p, int ret)
   }
 }
 
-//! @brief grep in string (STRING, STRING, REF INT, REF INT) INT.
+//! @brief INT regex cache hits
 
-int grep_in_string (char *pat, char *str, int *start, int *end)
+void genie_regex_cache_hits (NODE_T * p)
+{
+  PUSH_VALUE (p, A68_REGEX (hits), A68_INT);
+}
+
+//! @brief INT regex cache misses
+
+void genie_regex_cache_misses (NODE_T * p)
+{
+  PUSH_VALUE (p, A68_REGEX (misses), A68_INT);
+}
+
+//! @brief Drop a cache entry.
+
+static void free_regex_entry (REGEX_ENTRY_T * e)
+{
+  if (e->pattern != NO_TEXT) {
+    regfree (&(e->compiled));
+    a68_free (e->pattern);
+    a68_free (e->matches);
+    e->pattern = NO_TEXT;
+    e->matches = NO_REGMATCH;
+  }
+}
+
+//! @brief Drop all cache entries.
+
+void free_regex_cache (void)
 {
-  regex_t compiled;
-  int ret = regcomp (&compiled, pat, REG_NEWLINE | REG_EXTENDED);
+  for (int k = 0; k < REGEX_CACHE_SIZE; k++) {
+    free_regex_entry (&A68_REGEX (cache)[k]);
+  }
+}
+
+//! @brief Compiled form of "pat", from the cache when possible.
+
+static int compile_regex (char *pat, int cflags, REGEX_ENTRY_T ** entry)
+{
+  REGEX_ENTRY_T *lru = &A68_REGEX (cache)[0];
+  for (int k = 0; k < REGEX_CACHE_SIZE; k++) {
+    REGEX_ENTRY_T *e = &A68_REGEX (cache)[k];
+    if (e->pattern != NO_TEXT && e->cflags == cflags && strcmp (e->pattern, pat) == 0) {
+      e->stamp = ++A68_REGEX (clock);
+      A68_REGEX (hits)++;
+      *entry = e;
+      return 0;
+    }
+    if (e->pattern == NO_TEXT || (lru->pattern != NO_TEXT && e->stamp < lru->stamp)) {
+      lru = e;
+    }
+  }
+// Miss; compile into the least recently used slot.
+  A68_REGEX (misses)++;
+  free_regex_entry (lru);
+// A failed regcomp leaves nothing to regfree; the slot stays empty.
+  int ret = regcomp (&(lru->compiled), pat, cflags);
   if (ret != 0) {
-    regfree (&compiled);
     return ret;
   }
-  int nmatch = (int) (RE_NSUB (&compiled));
+  int nmatch = (int) (RE_NSUB (&(lru->compiled)));
   if (nmatch == 0) {
     nmatch = 1;
   }
-  regmatch_t *matches = a68_alloc ((size_t) (nmatch * SIZE_ALIGNED (regmatch_t)), __func__, __LINE__);
-  if (nmatch > 0 && matches == NO_REGMATCH) {
-    regfree (&compiled);
+  lru->matches = (regmatch_t *) a68_alloc ((size_t) (nmatch * SIZE_ALIGNED (regmatch_t)), __func__, __LINE__);
+  if (lru->matches == NO_REGMATCH) {
+    regfree (&(lru->compiled));
     return 2;
   }
-  ret = regexec (&compiled, str, (size_t) nmatch, matches, 0);
+  lru->pattern = new_string (pat, NO_TEXT);
+  lru->cflags = cflags;
+  lru->nmatch = nmatch;
+  lru->stamp = ++A68_REGEX (clock);
+  *entry = lru;
+  return 0;
+}
+
+//! @brief Match "pat" against "str" and yield the widest match.
+
+static int match_regex (char *pat, char *str, int eflags, int *start, int *end)
+{
+  REGEX_ENTRY_T *e;
+  int ret = compile_regex (pat, REG_NEWLINE | REG_EXTENDED, &e);
+  if (ret != 0) {
+    return ret;
+  }
+  regmatch_t *matches = e->matches;
+  ret = regexec (&(e->compiled), str, (size_t) e->nmatch, matches, eflags);
   if (ret != 0) {
-    regfree (&compiled);
     return ret;
   }
 // Find widest match. Do not assume it is the first one.
   int widest = 0, max_k = 0;
-  for (int k = 0; k < nmatch; k++) {
+  for (int k = 0; k < e->nmatch; k++) {
     int dif = (int) RM_EO (&matches[k]) - (int) RM_SO (&matches[k]);
     if (dif > widest) {
       widest = dif;
@@ -91,13 +161,19 @@ int grep_in_string (char *pat, char *str, int *start, int *end)
   if (end != NO_INT) {
     (*end) = (int) RM_EO (&matches[max_k]);
   }
-  a68_free (matches);
   return 0;
 }
 
-//! @brief PROC grep in string = (STRING, STRING, REF INT, REF INT) INT
+//! @brief grep in string (STRING, STRING, REF INT, REF INT) INT.
 
-void genie_grep_in_string (NODE_T * p)
+int grep_in_string (char *pat, char *str, int *start, int *end)
+{
+  return match_regex (pat, str, 0, start, end);
+}
+
+//! @brief Common part of grep in string and grep in substring.
+
+static void genie_grep (NODE_T * p, int eflags)
 {
   A68_REF ref_pat, ref_beg, ref_end, ref_str;
   POP_REF (p, &ref_end);
@@ -112,115 +188,37 @@ void genie_grep_in_string (NODE_T * p)
   reset_transput_buffer (STRING_BUFFER);
   add_a_string_transput_buffer (p, PATTERN_BUFFER, (BYTE_T *) & ref_pat);
   add_a_string_transput_buffer (p, STRING_BUFFER, (BYTE_T *) & ref_str);
-  regex_t compiled;
-  int ret = regcomp (&compiled, get_transput_buffer (PATTERN_BUFFER), REG_NEWLINE | REG_EXTENDED);
-  if (ret != 0) {
-    push_grep_ret (p, ret);
-    regfree (&compiled);
-    return;
-  }
-  int nmatch = (int) (RE_NSUB (&compiled));
-  if (nmatch == 0) {
-    nmatch = 1;
-  }
-  regmatch_t *matches = a68_alloc ((size_t) (nmatch * SIZE_ALIGNED (regmatch_t)), __func__, __LINE__);
-  if (nmatch > 0 && matches == NULL) {
-    ret = 2;
-    PUSH_VALUE (p, ret, A68_INT);
-    regfree (&compiled);
-    return;
-  }
-  ret = regexec (&compiled, get_transput_buffer (STRING_BUFFER), (size_t) nmatch, matches, 0);
+  int start, end;
+  int ret = match_regex (get_transput_buffer (PATTERN_BUFFER), get_transput_buffer (STRING_BUFFER), eflags, &start, &end);
   if (ret != 0) {
     push_grep_ret (p, ret);
-    regfree (&compiled);
     return;
   }
-// Find widest match. Do not assume it is the first one.
-  int widest = 0, max_k = 0;
-  for (int k = 0; k < nmatch; k++) {
-    int dif = (int) (RM_EO (&(matches[k]))) - (int) (RM_SO (&(matches[k])));
-    if (dif > widest) {
-      widest = dif;
-      max_k = k;
-    }
-  }
   if (!IS_NIL (ref_beg)) {
     A68_INT *i = DEREF (A68_INT, &ref_beg);
     STATUS (i) = INIT_MASK;
-    VALUE (i) = (int) (RM_SO (&(matches[max_k]))) + (int) (LOWER_BOUND (tup));
+    VALUE (i) = start + (int) (LOWER_BOUND (tup));
   }
   if (!IS_NIL (ref_end)) {
     A68_INT *i = DEREF (A68_INT, &ref_end);
     STATUS (i) = INIT_MASK;
-    VALUE (i) = (int) (RM_EO (&(matches[max_k]))) + (int) (LOWER_BOUND (tup)) - 1;
+    VALUE (i) = end + (int) (LOWER_BOUND (tup)) - 1;
   }
-  a68_free (matches);
   push_grep_ret (p, 0);
 }
 
+//! @brief PROC grep in string = (STRING, STRING, REF INT, REF INT) INT
+
+void genie_grep_in_string (NODE_T * p)
+{
+  genie_grep (p, 0);
+}
+
 //! @brief PROC grep in substring = (STRING, STRING, REF INT, REF INT) INT
 
 void genie_grep_in_substring (NODE_T * p)
 {
-  A68_REF ref_pat, ref_beg, ref_end, ref_str;
-  POP_REF (p, &ref_end);
-  POP_REF (p, &ref_beg);
-  POP_REF (p, &ref_str);
-  POP_REF (p, &ref_pat);
-  A68_REF row = *(A68_REF *) & ref_str;
-  CHECK_INIT (p, INITIALISED (&row), M_ROWS);
-  A68_ARRAY *arr; A68_TUPLE *tup;
-  GET_DESCRIPTOR (arr, tup, &row);
-  reset_transput_buffer (PATTERN_BUFFER);
-  reset_transput_buffer (STRING_BUFFER);
-  add_a_string_transput_buffer (p, PATTERN_BUFFER, (BYTE_T *) & ref_pat);
-  add_a_string_transput_buffer (p, STRING_BUFFER, (BYTE_T *) & ref_str);
-  regex_t compiled;
-  int ret = regcomp (&compiled, get_transput_buffer (PATTERN_BUFFER), REG_NEWLINE | REG_EXTENDED);
-  if (ret != 0) {
-    push_grep_ret (p, ret);
-    regfree (&compiled);
-    return;
-  }
-  int nmatch = (int) (RE_NSUB (&compiled));
-  if (nmatch == 0) {
-    nmatch = 1;
-  }
-  regmatch_t *matches = a68_alloc ((size_t) (nmatch * SIZE_ALIGNED (regmatch_t)), __func__, __LINE__);
-  if (nmatch > 0 && matches == NULL) {
-    ret = 2;
-    PUSH_VALUE (p, ret, A68_INT);
-    regfree (&compiled);
-    return;
-  }
-  ret = regexec (&compiled, get_transput_buffer (STRING_BUFFER), (size_t) nmatch, matches, REG_NOTBOL);
-  if (ret != 0) {
-    push_grep_ret (p, ret);
-    regfree (&compiled);
-    return;
-  }
-// Find widest match. Do not assume it is the first one.
-  int widest = 0, max_k = 0;
-  for (int k = 0; k < nmatch; k++) {
-    int dif = (int) (RM_EO (&(matches[k]))) - (int) (RM_SO (&(matches[k])));
-    if (dif > widest) {
-      widest = dif;
-      max_k = k;
-    }
-  }
-  if (!IS_NIL (ref_beg)) {
-    A68_INT *i = DEREF (A68_INT, &ref_beg);
-    STATUS (i) = INIT_MASK;
-    VALUE (i) = (int) (RM_SO (&(matches[max_k]))) + (int) (LOWER_BOUND (tup));
-  }
-  if (!IS_NIL (ref_end)) {
-    A68_INT *i = DEREF (A68_INT, &ref_end);
-    STATUS (i) = INIT_MASK;
-    VALUE (i) = (int) (RM_EO (&(matches[max_k]))) + (int) (LOWER_BOUND (tup)) - 1;
-  }
-  a68_free (matches);
-  push_grep_ret (p, 0);
+  genie_grep (p, REG_NOTBOL);
 }
 
 //! @brief PROC sub in string = (STRING, STRING, REF STRING) INT
@@ -240,40 +238,14 @@ void genie_sub_in_string (NODE_T * p)
   reset_transput_buffer (PATTERN_BUFFER);
   add_a_string_transput_buffer (p, PATTERN_BUFFER, (BYTE_T *) & ref_pat);
   add_a_string_transput_buffer (p, STRING_BUFFER, (BYTE_T *) DEREF (A68_REF, &ref_str));
-  regex_t compiled;
-  int ret = regcomp (&compiled, get_transput_buffer (PATTERN_BUFFER), REG_NEWLINE | REG_EXTENDED);
+  int start, end;
+  int ret = match_regex (get_transput_buffer (PATTERN_BUFFER), get_transput_buffer (STRING_BUFFER), 0, &start, &end);
   if (ret != 0) {
     push_grep_ret (p, ret);
-    regfree (&compiled);
     return;
   }
-  int nmatch = (int) (RE_NSUB (&compiled));
-  if (nmatch == 0) {
-    nmatch = 1;
-  }
-  regmatch_t *matches = a68_alloc ((size_t) (nmatch * SIZE_ALIGNED (regmatch_t)), __func__, __LINE__);
-  if (nmatch > 0 && matches == NULL) {
-    PUSH_VALUE (p, ret, A68_INT);
-    regfree (&compiled);
-    return;
-  }
-  ret = regexec (&compiled, get_transput_buffer (STRING_BUFFER), (size_t) nmatch, matches, 0);
-  if (ret != 0) {
-    push_grep_ret (p, ret);
-    regfree (&compiled);
-    return;
-  }
-// Find widest match. Do not assume it is the first one.
-  int widest = 0, max_k = 0;
-  for (int k = 0; k < nmatch; k++) {
-    int dif = (int) RM_EO (&(matches[k])) - (int) RM_SO (&(matches[k]));
-    if (dif > widest) {
-      widest = dif;
-      max_k = k;
-    }
-  }
 // Substitute text.
-  int begin = (int) RM_SO (&(matches[max_k])) + 1, end = (int) RM_EO (&(matches[max_k]));
+  int begin = start + 1;
   char *txt = get_transput_buffer (STRING_BUFFER);
   for (int k = 0; k < begin - 1; k++) {
     plusab_transput_buffer (p, REPLACE_BUFFER, txt[k]);
@@ -283,6 +255,5 @@ void genie_sub_in_string (NODE_T * p)
     plusab_transput_buffer (p, REPLACE_BUFFER, txt[k]);
   }
   *DEREF (A68_REF, &ref_str) = c_to_a_string (p, get_transput_buffer (REPLACE_BUFFER), DEFAULT_WIDTH);
-  a68_free (matches);
   push_grep_ret (p, 0);
 }
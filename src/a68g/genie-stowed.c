@@ -156,6 +156,9 @@ PROP_T genie_slice_name_quick (NODE_T * p)
   A68_REF *z = (A68_REF *) STACK_TOP;
   GENIE_UNIT_NO_GC (SUB (p));
   CHECK_REF (p, *z, MOID (SUB (p)));
+  if (MOID (SUB (p)) == M_REF_STRING) {
+    unshare_string (p, z);
+  }
   A68_ARRAY *arr; A68_TUPLE *tup;
   GET_DESCRIPTOR (arr, tup, DEREF (A68_ROW, z));
   ADDR_T pop_sp = A68_SP;
@@ -201,6 +204,9 @@ PROP_T genie_slice (NODE_T * p)
     POP_REF (p, &z);
     CHECK_REF (p, z, MOID (SUB (p)));
     scope = REF_SCOPE (&z);
+    if (MOID (SUB (p)) == M_REF_STRING) {
+      unshare_string (p, &z);
+    }
     PUSH_REF (p, *DEREF (A68_REF, &z));
   }
   NODE_T *indexer = NEXT_SUB (p);
@@ -299,8 +305,8 @@ PROP_T genie_selection_value_quick (NODE_T * p)
   A68_SP = pop_sp;
   if (offset > 0) {
     MOVE (STACK_TOP, STACK_OFFSET (offset), (unt) size);
-    genie_check_initialisation (p, STACK_TOP, result_mode);
   }
+  genie_check_initialisation (p, STACK_TOP, result_mode);
   INCREMENT_STACK_POINTER (selector, size);
   return GPROP (p);
 }
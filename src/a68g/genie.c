@@ -242,6 +242,37 @@ int mode_attribute (MOID_T * p)
   }
 }
 
+// A LOC variable of primitive mode that is declared with a source holds a
+// value from its declaration on, since any value that can be assigned to it
+// is initialised. An applied occurrence that follows the declaration can be
+// dereferenced without checking the value, unless a jump can pass over the
+// declaration, which requires a label in the same serial clause.
+
+//! @brief Whether applied identifier "p" for tag "q" always yields an initialised value.
+
+static BOOL_T is_initialised_variable (NODE_T * p, TAG_T * q)
+{
+  NODE_T *d = NODE (q);
+  if (ISNT (d, DEFINING_IDENTIFIER) || HEAP (q) != LOC_SYMBOL || BODY (q) == NO_TAG) {
+    return A68_FALSE;
+  }
+  if (NEXT (d) == NO_NODE || ISNT (NEXT (d), ASSIGN_SYMBOL) || LABELS (TAG_TABLE (q)) != NO_TAG) {
+    return A68_FALSE;
+  }
+  MOID_T *m = MOID (q);
+  if (!IS_REF (m) || !(SUB (m) == M_INT || SUB (m) == M_REAL || SUB (m) == M_BOOL || SUB (m) == M_CHAR || SUB (m) == M_BITS)) {
+    return A68_FALSE;
+  }
+// Nodes are numbered in textual order; find the last one of the source.
+  NODE_T *u = NEXT_NEXT (d);
+  while (SUB (u) != NO_NODE) {
+    for (u = SUB (u); NEXT (u) != NO_NODE; FORWARD (u)) {
+      ;
+    }
+  }
+  return (BOOL_T) (NUMBER (p) > NUMBER (u));
+}
+
 //! @brief Perform tasks before interpretation.
 
 void genie_preprocess (NODE_T * p, int *max_lev, void *compile_plugin)
@@ -313,6 +344,7 @@ void genie_preprocess (NODE_T * p, int *max_lev, void *compile_plugin)
       if (q != NO_TAG && NODE (q) != NO_NODE && TABLE (NODE (q)) != NO_TABLE) {
         LEVEL (GINFO (p)) = LEX_LEVEL (NODE (q));
         OFFSET (GINFO (p)) = &(A68_STACK[FRAME_INFO_SIZE + OFFSET (q)]);
+        IS_INITIALISED (GINFO (p)) = is_initialised_variable (p, q);
       }
     } else if (IS (p, OPERATOR)) {
       TAG_T *q = TAX (p);
@@ -378,6 +410,7 @@ void genie (void *compile_plugin)
   A68 (do_confirm_exit) = A68_TRUE;
 #if defined (BUILD_PARALLEL_CLAUSE)
   ASSERT (pthread_mutex_init (&A68_PAR (unit_sema), NULL) == 0);
+  ASSERT (pthread_cond_init (&A68_PAR (unit_done), NULL) == 0);
 #endif
 // Dive into the program.
   if (setjmp (A68 (genie_exit_label)) == 0) {
@@ -407,6 +440,9 @@ void genie (void *compile_plugin)
     genie_init_transput (TOP_NODE (&A68_JOB));
     A68 (cputime_0) = seconds ();
     A68_GC (sema) = 0;
+    if (OPTION_PROFILE (&A68_JOB)) {
+      genie_init_profile ();
+    }
 // Here we go ...
     A68 (in_execution) = A68_TRUE;
     A68 (f_entry) = TOP_NODE (&A68_JOB);
@@ -441,6 +477,9 @@ void genie (void *compile_plugin)
       }
     }
   }
+  if (OPTION_PROFILE (&A68_JOB)) {
+    genie_profile_report ();
+  }
   A68 (in_execution) = A68_FALSE;
 }
 
@@ -704,6 +743,9 @@ char *propagator_name (const PROP_PROC * p)
   if (p == genie_assignation_constant) {
     return "genie_assignation_constant";
   }
+  if (p == genie_bytecode) {
+    return "genie_bytecode";
+  }
   if (p == genie_call) {
     return "genie_call";
   }
@@ -737,6 +779,15 @@ char *propagator_name (const PROP_PROC * p)
   if (p == genie_dereference_frame_identifier) {
     return "genie_dereference_frame_identifier";
   }
+  if (p == genie_dereference_loc_identifier) {
+    return "genie_dereference_loc_identifier";
+  }
+  if (p == genie_dereference_loc_int) {
+    return "genie_dereference_loc_int";
+  }
+  if (p == genie_dereference_loc_real) {
+    return "genie_dereference_loc_real";
+  }
   if (p == genie_dereference_selection_name_quick) {
     return "genie_dereference_selection_name_quick";
   }
@@ -868,11 +919,14 @@ char *propagator_name (const PROP_PROC * p)
   if (p == genie_voiding_assignation_constant) {
     return "genie_voiding_assignation_constant";
   }
+  if (p == genie_voiding_assignation_identifier) {
+    return "genie_voiding_assignation_identifier";
+  }
   if (p == genie_widen) {
     return "genie_widen";
   }
   if (p == genie_widen_int_to_real) {
     return "genie_widen_int_to_real";
   }
-  return NO_TEXT;
+  return fused_propagator_name (p);
 }
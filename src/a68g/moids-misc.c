@@ -879,9 +879,19 @@ BOOL_T is_coercible_series (MOID_T * p, MOID_T * q, int c, int deflex)
   }
 }
 
-//! @brief Whether "p" can be coerced to "q" in a "c" context.
+//! @brief Forget remembered coercions, for instance when the mode table changes.
 
-BOOL_T is_coercible (MOID_T * p, MOID_T * q, int c, int deflex)
+void init_coercion_memo (void)
+{
+  for (int k = 0; k < COERCION_MEMO_SIZE; k++) {
+    COERCION_T *e = &A68 (coercion_memo)[k];
+    e->from = e->to = NO_MOID;
+  }
+}
+
+//! @brief Whether "p" can be coerced to "q" in a "c" context, without memo.
+
+static BOOL_T prove_coercible (MOID_T * p, MOID_T * q, int c, int deflex)
 {
   if (is_mode_isnt_well (p) || is_mode_isnt_well (q)) {
     return A68_TRUE;
@@ -900,6 +910,30 @@ BOOL_T is_coercible (MOID_T * p, MOID_T * q, int c, int deflex)
   }
 }
 
+//! @brief Whether "p" can be coerced to "q" in a "c" context.
+
+BOOL_T is_coercible (MOID_T * p, MOID_T * q, int c, int deflex)
+{
+// Modes in the table are final once checking starts, so a pair can be
+// remembered. Displays and series are built on the fly and are not.
+  if (p == NO_MOID || q == NO_MOID || IS (p, STOWED_MODE) || IS (p, SERIES_MODE) || IS (q, STOWED_MODE) || IS (q, SERIES_MODE)) {
+    return prove_coercible (p, q, c, deflex);
+  }
+  uintptr_t h = ((uintptr_t) p >> 4) * 31 + ((uintptr_t) q >> 4);
+  h = h * 31 + (uintptr_t) (c * 8 + deflex);
+  COERCION_T *e = &A68 (coercion_memo)[(h ^ (h >> 12)) & (COERCION_MEMO_SIZE - 1)];
+  if (e->from == p && e->to == q && e->sort == c && e->deflex == deflex) {
+    return e->coercible;
+  }
+  BOOL_T z = prove_coercible (p, q, c, deflex);
+  e->from = p;
+  e->to = q;
+  e->sort = c;
+  e->deflex = deflex;
+  e->coercible = z;
+  return z;
+}
+
 //! @brief Whether coercible in context.
 
 BOOL_T is_coercible_in_context (SOID_T * p, SOID_T * q, int deflex)
@@ -0,0 +1,508 @@
+//! @file mp-fast.c
+//! @author J. Marcel van der Veer
+
+//! @section Copyright
+//!
+//! This file is part of Algol68G - an Algol 68 compiler-interpreter.
+//! Copyright 2001-2024 J. Marcel van der Veer [algol68g@xs4all.nl].
+
+//! @section License
+//!
+//! This program is free software; you can redistribute it and/or modify it
+//! under the terms of the GNU General Public License as published by the
+//! Free Software Foundation; either version 3 of the License, or
+//! (at your option) any later version.
+//!
+//! This program is distributed in the hope that it will be useful, but
+//! WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+//! or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+//! more details. You should have received a copy of the GNU General Public
+//! License along with this program. If not, see [http://www.gnu.org/licenses/].
+
+//! @section Synopsis
+//!
+//! [LONG] LONG REAL multiplication and division for many digits.
+
+// When LONG LONG precision is raised to thousands of digits, mul_mp and
+// div_mp hand over to the routines here. Mantissas are multiplied as
+// polynomials in MP_RADIX: Karatsuba and Toom-3 split the operands
+// recursively, and for very long operands a number-theoretic transform over
+// two primes computes the convolution, that is reconstructed by the Chinese
+// remainder theorem. Coefficients are exact, so carries are propagated once,
+// at the end. Division computes the reciprocal of the divisor by Newton
+// iteration that doubles the number of digits on each step.
+//
+// Below MP_FAST_DIGITS the classic routines in mp.c are used, so results
+// at usual precisions are not affected.
+
+#include "a68g.h"
+#include "a68g-mp.h"
+
+#if defined (__SIZEOF_INT128__)
+
+// Operand coefficients fit a machine word, product coefficients need two.
+
+typedef long long int CONV_DIGIT_T;
+typedef __int128 CONV_T;
+typedef unsigned long long int NTT_T;
+typedef unsigned __int128 NTT_WIDE_T;
+
+// Operand lengths, in digits, from which an algorithm takes over.
+// Toom-3 grows operands sevenfold per level and Karatsuba twofold, which
+// bounds the levels between MP_TOOM_DIGITS and MP_NTT_DIGITS that
+// CONV_DIGIT_T can hold.
+
+#define MP_KARATSUBA_DIGITS 32
+#define MP_TOOM_DIGITS 192
+#define MP_NTT_DIGITS 10240
+
+// Scratch space, used as a stack by the recursive routines.
+
+static BYTE_T *conv_arena = NO_BYTE;
+static size_t conv_arena_size = 0, conv_arena_top = 0;
+
+//! @brief Make sure "size" bytes of scratch space are available.
+
+static void conv_reserve (size_t size)
+{
+  if (size > conv_arena_size) {
+    if (conv_arena != NO_BYTE) {
+      a68_free (conv_arena);
+    }
+    conv_arena = (BYTE_T *) a68_alloc (size, __func__, __LINE__);
+    ABEND (conv_arena == NO_BYTE, ERROR_OUT_OF_CORE, __func__);
+    conv_arena_size = size;
+  }
+  conv_arena_top = 0;
+}
+
+//! @brief Allocate "size" bytes of scratch space.
+
+static void *conv_get (size_t size)
+{
+  size_t top = conv_arena_top;
+  size = (size + 15) & ~((size_t) 15);
+  ABEND (top + size > conv_arena_size, ERROR_INTERNAL_CONSISTENCY, __func__);
+  conv_arena_top += size;
+  return (void *) &conv_arena[top];
+}
+
+static void conv_mul (CONV_T *, CONV_DIGIT_T *, CONV_DIGIT_T *, int);
+
+//! @brief Set c [0 .. 2n - 2] to the convolution of a [0 .. n - 1] and b [0 .. n - 1].
+
+static void conv_school (CONV_T * c, CONV_DIGIT_T * a, CONV_DIGIT_T * b, int n)
+{
+// Column by column, so each sum stays in registers.
+  for (int k = 0; k < 2 * n - 1; k++) {
+    int lo = (k < n ? 0 : k - n + 1), hi = (k < n ? k : n - 1);
+    CONV_T sum = 0;
+    for (int i = lo; i <= hi; i++) {
+      sum += (CONV_T) a[i] * b[k - i];
+    }
+    c[k] = sum;
+  }
+}
+
+//! @brief Karatsuba convolution.
+
+static void conv_karatsuba (CONV_T * c, CONV_DIGIT_T * a, CONV_DIGIT_T * b, int n)
+{
+// a = a0 + t^h a1 with a1 possibly one digit shorter than a0.
+  size_t top = conv_arena_top;
+  int h = (n + 1) / 2, l = n - h;
+  CONV_DIGIT_T *s = (CONV_DIGIT_T *) conv_get ((size_t) h * sizeof (CONV_DIGIT_T));
+  CONV_DIGIT_T *t = (CONV_DIGIT_T *) conv_get ((size_t) h * sizeof (CONV_DIGIT_T));
+  CONV_T *z0 = (CONV_T *) conv_get ((size_t) (2 * h) * sizeof (CONV_T));
+  CONV_T *z1 = (CONV_T *) conv_get ((size_t) (2 * h) * sizeof (CONV_T));
+  CONV_T *z2 = (CONV_T *) conv_get ((size_t) (2 * h) * sizeof (CONV_T));
+  for (int k = 0; k < h; k++) {
+    s[k] = a[k] + (k < l ? a[h + k] : 0);
+    t[k] = b[k] + (k < l ? b[h + k] : 0);
+  }
+  conv_mul (z0, a, b, h);
+  conv_mul (z2, &a[h], &b[h], l);
+  conv_mul (z1, s, t, h);
+  for (int k = 0; k < 2 * h - 1; k++) {
+    z1[k] -= z0[k] + (k < 2 * l - 1 ? z2[k] : 0);
+  }
+  for (int k = 0; k < 2 * n - 1; k++) {
+    c[k] = 0;
+  }
+  for (int k = 0; k < 2 * h - 1; k++) {
+    c[k] += z0[k];
+    if (h + k < 2 * n - 1) {
+      c[h + k] += z1[k];
+    }
+  }
+  for (int k = 0; k < 2 * l - 1; k++) {
+    c[2 * h + k] += z2[k];
+  }
+  conv_arena_top = top;
+}
+
+//! @brief Toom-3 convolution, with Bodrato's interpolation sequence.
+
+static void conv_toom (CONV_T * c, CONV_DIGIT_T * a, CONV_DIGIT_T * b, int n)
+{
+// a = a0 + t^k a1 + t^2k a2, evaluated at 0, 1, -1, -2 and infinity.
+  size_t top = conv_arena_top;
+  int k = (n + 2) / 3, r = n - 2 * k, m = 2 * k - 1;
+  CONV_DIGIT_T *ea[3], *eb[3];
+  CONV_T *rz[5];
+  for (int j = 0; j < 3; j++) {
+    ea[j] = (CONV_DIGIT_T *) conv_get ((size_t) k * sizeof (CONV_DIGIT_T));
+    eb[j] = (CONV_DIGIT_T *) conv_get ((size_t) k * sizeof (CONV_DIGIT_T));
+  }
+  for (int j = 0; j < 5; j++) {
+    rz[j] = (CONV_T *) conv_get ((size_t) (2 * k) * sizeof (CONV_T));
+  }
+// Evaluate at 1, -1 and -2.
+  for (int j = 0; j < k; j++) {
+    CONV_DIGIT_T a0 = a[j], a1 = a[k + j], a2 = (j < r ? a[2 * k + j] : 0);
+    CONV_DIGIT_T b0 = b[j], b1 = b[k + j], b2 = (j < r ? b[2 * k + j] : 0);
+    ea[0][j] = a0 + a1 + a2;
+    ea[1][j] = a0 - a1 + a2;
+    ea[2][j] = a0 - 2 * a1 + 4 * a2;
+    eb[0][j] = b0 + b1 + b2;
+    eb[1][j] = b0 - b1 + b2;
+    eb[2][j] = b0 - 2 * b1 + 4 * b2;
+  }
+// Pointwise products.
+  CONV_T *r0 = rz[0], *r1 = rz[1], *r2 = rz[2], *r3 = rz[3], *r4 = rz[4];
+  conv_mul (r0, a, b, k);
+  conv_mul (r1, ea[0], eb[0], k);
+  conv_mul (r2, ea[1], eb[1], k);
+  conv_mul (r3, ea[2], eb[2], k);
+  for (int j = 0; j < m; j++) {
+    r4[j] = 0;
+  }
+  conv_mul (r4, &a[2 * k], &b[2 * k], r);
+// Interpolate. Divisions are exact.
+  for (int j = 0; j < m; j++) {
+    CONV_T v0 = r0[j], v1 = r1[j], vm1 = r2[j], vm2 = r3[j], vinf = (j < 2 * r - 1 ? r4[j] : 0);
+    CONV_T w3 = (vm2 - v1) / 3;
+    CONV_T w1 = (v1 - vm1) / 2;
+    CONV_T w2 = vm1 - v0;
+    w3 = (w2 - w3) / 2 + 2 * vinf;
+    w2 = w2 + w1 - vinf;
+    w1 = w1 - w3;
+    r1[j] = w1;
+    r2[j] = w2;
+    r3[j] = w3;
+  }
+// Recompose.
+  for (int j = 0; j < 2 * n - 1; j++) {
+    c[j] = 0;
+  }
+  for (int i = 0; i < 4; i++) {
+    CONV_T *u = rz[i];
+    for (int j = 0; j < m && i * k + j < 2 * n - 1; j++) {
+      c[i * k + j] += u[j];
+    }
+  }
+  for (int j = 0; j < 2 * r - 1; j++) {
+    c[4 * k + j] += r4[j];
+  }
+  conv_arena_top = top;
+}
+
+//! @brief Set c [0 .. 2n - 2] to the convolution of a and b, by operand length.
+
+static void conv_mul (CONV_T * c, CONV_DIGIT_T * a, CONV_DIGIT_T * b, int n)
+{
+  if (n < MP_KARATSUBA_DIGITS) {
+    conv_school (c, a, b, n);
+  } else if (n < MP_TOOM_DIGITS) {
+    conv_karatsuba (c, a, b, n);
+  } else {
+    conv_toom (c, a, b, n);
+  }
+}
+
+// Number-theoretic transform modulo primes c * 2^k + 1, in Montgomery form.
+
+typedef struct NTT_PRIME_T NTT_PRIME_T;
+
+struct NTT_PRIME_T
+{
+  NTT_T modulus, root, inverse, r2, one;
+};
+
+static NTT_PRIME_T ntt_primes[2] = {
+  {4179340454199820289ULL, 3, 0, 0, 0}, // 29 * 2^57 + 1
+  {2485986994308513793ULL, 5, 0, 0, 0}  // 69 * 2^55 + 1
+};
+
+static BOOL_T ntt_ready = A68_FALSE;
+
+//! @brief Montgomery product of "a" and "b".
+
+static inline NTT_T ntt_mul (NTT_T a, NTT_T b, NTT_PRIME_T * q)
+{
+  NTT_WIDE_T t = (NTT_WIDE_T) a * b;
+  NTT_T m = (NTT_T) t * q->inverse;
+  NTT_T u = (NTT_T) ((t + (NTT_WIDE_T) m * q->modulus) >> 64);
+  return (u >= q->modulus ? u - q->modulus : u);
+}
+
+static inline NTT_T ntt_add (NTT_T a, NTT_T b, NTT_PRIME_T * q)
+{
+  NTT_T s = a + b;
+  return (s >= q->modulus ? s - q->modulus : s);
+}
+
+static inline NTT_T ntt_sub (NTT_T a, NTT_T b, NTT_PRIME_T * q)
+{
+  return (a >= b ? a - b : a + q->modulus - b);
+}
+
+//! @brief Montgomery power "a" ** "e".
+
+static NTT_T ntt_pow (NTT_T a, NTT_T e, NTT_PRIME_T * q)
+{
+  NTT_T z = q->one;
+  while (e > 0) {
+    if (e & 1) {
+      z = ntt_mul (z, a, q);
+    }
+    a = ntt_mul (a, a, q);
+    e >>= 1;
+  }
+  return z;
+}
+
+//! @brief Set up Montgomery constants.
+
+static void ntt_init (void)
+{
+  for (int k = 0; k < 2; k++) {
+    NTT_PRIME_T *q = &ntt_primes[k];
+    NTT_T p = q->modulus, inv = p;
+// Newton iteration for 1 / p modulo 2^64.
+    for (int j = 0; j < 6; j++) {
+      inv *= 2 - p * inv;
+    }
+    q->inverse = -inv;
+    q->one = ((NTT_T) 0 - p) % p;
+    q->r2 = (NTT_T) (((NTT_WIDE_T) q->one * q->one) % p);
+  }
+  ntt_ready = A68_TRUE;
+}
+
+//! @brief In-place transform of length "len", a power of two.
+
+static void ntt_transform (NTT_T * a, int len, BOOL_T inverse, NTT_PRIME_T * q)
+{
+  for (int i = 1, j = 0; i < len; i++) {
+    int bit = len >> 1;
+    for (; j & bit; bit >>= 1) {
+      j ^= bit;
+    }
+    j ^= bit;
+    if (i < j) {
+      NTT_T t = a[i];
+      a[i] = a[j];
+      a[j] = t;
+    }
+  }
+  size_t top = conv_arena_top;
+  NTT_T *w = (NTT_T *) conv_get ((size_t) (len / 2) * sizeof (NTT_T));
+  NTT_T g = ntt_mul (q->root, q->r2, q);
+  for (int half = 1; half < len; half <<= 1) {
+    NTT_T w_len = ntt_pow (g, (q->modulus - 1) / (NTT_T) (2 * half), q);
+    if (inverse) {
+      w_len = ntt_pow (w_len, q->modulus - 2, q);
+    }
+    w[0] = q->one;
+    for (int j = 1; j < half; j++) {
+      w[j] = ntt_mul (w[j - 1], w_len, q);
+    }
+    for (int i = 0; i < len; i += 2 * half) {
+      NTT_T *u = &a[i], *v = &a[i + half];
+      for (int j = 0; j < half; j++) {
+        NTT_T x = u[j], y = ntt_mul (v[j], w[j], q);
+        u[j] = ntt_add (x, y, q);
+        v[j] = ntt_sub (x, y, q);
+      }
+    }
+  }
+  if (inverse) {
+    NTT_T n_inv = ntt_pow (ntt_mul ((NTT_T) len, q->r2, q), q->modulus - 2, q);
+    for (int i = 0; i < len; i++) {
+      a[i] = ntt_mul (a[i], n_inv, q);
+    }
+  }
+  conv_arena_top = top;
+}
+
+//! @brief Convolution of non-negative digits through two transforms.
+
+static void conv_ntt (CONV_T * c, CONV_DIGIT_T * a, CONV_DIGIT_T * b, int n)
+{
+  if (!ntt_ready) {
+    ntt_init ();
+  }
+  int len = 1;
+  while (len < 2 * n - 1) {
+    len <<= 1;
+  }
+  size_t top = conv_arena_top;
+  NTT_T *res[2];
+  NTT_T *fb = (NTT_T *) conv_get ((size_t) len * sizeof (NTT_T));
+  for (int k = 0; k < 2; k++) {
+    NTT_PRIME_T *q = &ntt_primes[k];
+    NTT_T *fa = res[k] = (NTT_T *) conv_get ((size_t) len * sizeof (NTT_T));
+    for (int j = 0; j < len; j++) {
+      fa[j] = (j < n ? ntt_mul ((NTT_T) a[j], q->r2, q) : 0);
+      fb[j] = (j < n ? ntt_mul ((NTT_T) b[j], q->r2, q) : 0);
+    }
+    ntt_transform (fa, len, A68_FALSE, q);
+    ntt_transform (fb, len, A68_FALSE, q);
+    for (int j = 0; j < len; j++) {
+      fa[j] = ntt_mul (fa[j], fb[j], q);
+    }
+    ntt_transform (fa, len, A68_TRUE, q);
+    for (int j = 0; j < 2 * n - 1; j++) {
+      fa[j] = ntt_mul (fa[j], 1, q);
+    }
+  }
+// Chinese remainder: c = r0 + p0 * ((r1 - r0) / p0 mod p1).
+  NTT_T p0 = ntt_primes[0].modulus, p1 = ntt_primes[1].modulus, inv = 1, base = p0 % p1;
+  for (NTT_T e = p1 - 2; e > 0; e >>= 1) {
+    if (e & 1) {
+      inv = (NTT_T) (((NTT_WIDE_T) inv * base) % p1);
+    }
+    base = (NTT_T) (((NTT_WIDE_T) base * base) % p1);
+  }
+  for (int j = 0; j < 2 * n - 1; j++) {
+    NTT_T r0 = res[0][j], r1 = res[1][j];
+    NTT_T d = (r1 >= r0 % p1 ? r1 - r0 % p1 : r1 + p1 - r0 % p1);
+    NTT_T t = (NTT_T) (((NTT_WIDE_T) d * inv) % p1);
+    c[j] = (CONV_T) ((NTT_WIDE_T) r0 + (NTT_WIDE_T) p0 * t);
+  }
+  conv_arena_top = top;
+}
+
+//! @brief Set w [1 .. digs_w] to the leading digits of x [1 .. digs] * y [1 .. digs].
+
+void mul_mp_fast (MP_T * w, MP_T * x, MP_T * y, int digs, int digs_w)
+{
+// Digit x [i] * y [j] lands in w [i + j]; w [1] only receives carries.
+  size_t need = (size_t) digs * (digs < MP_NTT_DIGITS ? 640 : 160) + 4096;
+  conv_reserve (need);
+  CONV_DIGIT_T *a = (CONV_DIGIT_T *) conv_get ((size_t) digs * sizeof (CONV_DIGIT_T));
+  CONV_DIGIT_T *b = (CONV_DIGIT_T *) conv_get ((size_t) digs * sizeof (CONV_DIGIT_T));
+  CONV_T *c = (CONV_T *) conv_get ((size_t) (2 * digs) * sizeof (CONV_T));
+  for (int k = 0; k < digs; k++) {
+    a[k] = (CONV_DIGIT_T) x[k];
+    b[k] = (CONV_DIGIT_T) y[k];
+  }
+  if (digs >= MP_NTT_DIGITS) {
+    conv_ntt (c, a, b, digs);
+  } else {
+    conv_mul (c, a, b, digs);
+  }
+  CONV_T carry = 0;
+  for (int k = 2 * digs; k >= 2; k--) {
+    CONV_T v = c[k - 2] + carry;
+    carry = v / MP_RADIX;
+    if (k <= digs_w) {
+      w[k - 1] = (MP_T) (v - carry * MP_RADIX);
+    }
+  }
+  w[0] = (MP_T) carry;
+}
+
+#else
+
+//! @brief Set w [1 .. digs_w] to the leading digits of x [1 .. digs] * y [1 .. digs].
+
+void mul_mp_fast (MP_T * w, MP_T * x, MP_T * y, int digs, int digs_w)
+{
+// Without double-word integers, fall back to schoolbook with normalisation.
+  for (int k = 0; k < digs_w; k++) {
+    w[k] = 0;
+  }
+  int oflow = (int) FLOOR_MP ((MP_REAL_T) MAX_REPR_INT / (2 * MP_REAL_RADIX * MP_REAL_RADIX)) - 1;
+  for (int i = 0; i < digs; i++) {
+    for (int j = 0; j < digs && i + j + 1 < digs_w; j++) {
+      w[i + j + 1] += x[i] * y[j];
+    }
+    if ((i + 1) % oflow == 0 || i == digs - 1) {
+      for (int k = digs_w - 1; k >= 1; k--) {
+        MP_T carry = (MP_T) ((MP_INT_T) (w[k] / (MP_T) MP_RADIX));
+        w[k] -= carry * (MP_T) MP_RADIX;
+        w[k - 1] += carry;
+      }
+    }
+  }
+}
+
+#endif
+
+//! @brief Clear digits "from" .. "digs" of "z".
+
+static void clear_mp_tail (MP_T * z, int from, int digs)
+{
+  for (int k = from; k <= digs; k++) {
+    MP_DIGIT (z, k) = (MP_T) 0;
+  }
+}
+
+//! @brief Set "u" to "r" * "t" where "t" is small, to "k" digits of which "h" are known.
+
+static void newton_correction (NODE_T * p, MP_T * u, MP_T * r, MP_T * t, int k, int h)
+{
+// Relative to "r", "t" is of order MP_RADIX ** (1 - h), so only the
+// trailing k - h digits of the product matter.
+  int n = MIN (k, k - h + 3);
+  (void) mul_mp (p, u, r, t, n);
+  clear_mp_tail (u, n + 1, k);
+}
+
+//! @brief Set "z" to the quotient of positive "x" and positive "y" by Newton iteration.
+
+MP_T *div_mp_newton (NODE_T * p, MP_T * z, MP_T * x, MP_T * y, int digs)
+{
+// The reciprocal r of y follows from r <- r + r (1 - y r), that doubles the
+// number of correct digits each step, so precision is doubled as well,
+// starting from a REAL estimate. A leading digit of r may be small, so h
+// digits carry h - 1 correct ones, and each step keeps a digit in reserve.
+// The last step is merged with the multiplication by x, after Karp and
+// Markstein.
+  ADDR_T pop_sp = A68_SP;
+  int gdigs = digs + 2, steps = 0, prec[64];
+  MP_T *r = nil_mp (p, gdigs), *q = nil_mp (p, gdigs), *t = nil_mp (p, gdigs), *u = nil_mp (p, gdigs);
+  MP_T *y_g = len_mp (p, y, digs, gdigs), *x_g = len_mp (p, x, digs, gdigs);
+// Not mp_one, that may be reallocated while "x" is the cached one.
+  MP_T *one = lit_mp (p, 1, 0, gdigs);
+  MP_REAL_T lead = MP_DIGIT (y, 1) + (MP_DIGIT (y, 2) + MP_DIGIT (y, 3) / MP_REAL_RADIX) / MP_REAL_RADIX;
+  (void) real_to_mp (p, r, (REAL_T) (MP_REAL_RADIX / lead), gdigs);
+  MP_EXPONENT (r) -= MP_EXPONENT (y) + 1;
+  clear_mp_tail (r, 4, gdigs);
+  for (int k = gdigs; k > 3 && steps < 63; k = (k + 3) / 2) {
+    prec[steps++] = k;
+  }
+  prec[steps++] = 3;
+// Reciprocal to half the final precision.
+  int h = 2;
+  for (int j = steps - 1; j >= 1; j--) {
+    int k = prec[j];
+    (void) mul_mp (p, t, y_g, r, k);
+    (void) sub_mp (p, t, one, t, k);
+    newton_correction (p, u, r, t, k, h);
+    (void) add_mp (p, r, r, u, k);
+    h = k;
+  }
+// q = x r, then q <- q + r (x - y q).
+  (void) mul_mp (p, q, x_g, r, h);
+  clear_mp_tail (q, h + 1, gdigs);
+  (void) mul_mp (p, t, y_g, q, gdigs);
+  (void) sub_mp (p, t, x_g, t, gdigs);
+  newton_correction (p, u, r, t, gdigs, h);
+  (void) add_mp (p, q, q, u, gdigs);
+  (void) shorten_mp (p, z, digs, q, gdigs);
+  A68_SP = pop_sp;
+  return z;
+}
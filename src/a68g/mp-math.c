@@ -256,10 +256,10 @@ MP_T *exp_mp (NODE_T * p, MP_T * z, MP_T * x, int digs)
     if (MP_EXPONENT (tmp) <= (MP_EXPONENT (sum) - gdigs)) {
       iter = A68_FALSE;
     } else {
-      (void) add_mp (p, sum, sum, tmp, gdigs);
+      (void) plusab_mp (p, sum, tmp, gdigs);
       (void) mul_mp (p, pwr, pwr, x_g, gdigs);
       n++;
-      (void) mul_mp_digit (p, fac, fac, (MP_T) n, gdigs);
+      (void) timesab_mp_digit (p, fac, (MP_T) n, gdigs);
     }
   }
 // Square exp (x) up.
@@ -321,10 +321,10 @@ MP_T *expm1_mp (NODE_T * p, MP_T * z, MP_T * x, int digs)
     if (MP_EXPONENT (tmp) <= (MP_EXPONENT (sum) - gdigs)) {
       iter = A68_FALSE;
     } else {
-      (void) add_mp (p, sum, sum, tmp, gdigs);
+      (void) plusab_mp (p, sum, tmp, gdigs);
       (void) mul_mp (p, pwr, pwr, x_g, gdigs);
       n++;
-      (void) mul_mp_digit (p, fac, fac, (MP_T) n, gdigs);
+      (void) timesab_mp_digit (p, fac, (MP_T) n, gdigs);
     }
   }
   (void) shorten_mp (p, z, digs, sum, gdigs);
@@ -421,7 +421,7 @@ MP_T *ln_mp (NODE_T * p, MP_T * z, MP_T * x, int digs)
         iter = A68_FALSE;
       } else {
         MP_DIGIT (tmp, 1) = (EVEN (n) ? -MP_DIGIT (tmp, 1) : MP_DIGIT (tmp, 1));
-        (void) add_mp (p, z_g, z_g, tmp, gdigs);
+        (void) plusab_mp (p, z_g, tmp, gdigs);
         (void) mul_mp (p, pwr, pwr, x_g, gdigs);
         n++;
       }
@@ -679,15 +679,15 @@ MP_T *sin_mp (NODE_T * p, MP_T * z, MP_T * x, int digs)
       iter = A68_FALSE;
     } else {
       if (even) {
-        (void) add_mp (p, z_g, z_g, tmp, gdigs);
+        (void) plusab_mp (p, z_g, tmp, gdigs);
         even = A68_FALSE;
       } else {
         (void) sub_mp (p, z_g, z_g, tmp, gdigs);
         even = A68_TRUE;
       }
       (void) mul_mp (p, pwr, pwr, sqr, gdigs);
-      (void) mul_mp_digit (p, fac, fac, (MP_T) (++n), gdigs);
-      (void) mul_mp_digit (p, fac, fac, (MP_T) (++n), gdigs);
+      (void) timesab_mp_digit (p, fac, (MP_T) (++n), gdigs);
+      (void) timesab_mp_digit (p, fac, (MP_T) (++n), gdigs);
     }
   }
 // Inverse scaling using sin (3x) = sin (x) * (3 - 4 sin ** 2 (x)).
@@ -888,7 +888,7 @@ MP_T *atan_mp (NODE_T * p, MP_T * z, MP_T * x, int digs)
         iter = A68_FALSE;
       } else {
         if (even) {
-          (void) add_mp (p, z_g, z_g, tmp, gdigs);
+          (void) plusab_mp (p, z_g, tmp, gdigs);
           even = A68_FALSE;
         } else {
           (void) sub_mp (p, z_g, z_g, tmp, gdigs);
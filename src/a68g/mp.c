@@ -121,6 +121,26 @@ int width_to_mp_digits (int n)
   return 1 + n / LOG_MP_RADIX;
 }
 
+//! @brief Workspace for "digs" digits when scratch_mp ran out of it.
+
+MP_T *scratch_mp_overflow (NODE_T * p, int digs)
+{
+  size_t top = A68_MP (mp_scratch_top), size = SIZE_MP (digs);
+  if (top + size > A68_MP (mp_scratch_want)) {
+    A68_MP (mp_scratch_want) = top + size;
+  }
+  if (top > 0) {
+// Blocks are in use, so the workspace cannot move yet.
+    return empty_mp (p, digs);
+  }
+  size_t want = MAX (2 * A68_MP (mp_scratch_want), 32 * size);
+  a68_free (A68_MP (mp_scratch));
+  A68_MP (mp_scratch) = get_heap_space (want);
+  A68_MP (mp_scratch_size) = want;
+  A68_MP (mp_scratch_top) = size;
+  return (MP_T *) A68_MP (mp_scratch);
+}
+
 //! @brief Unformatted write of z to stdout; debugging routine.
 
 #if !defined (BUILD_WIN32)
@@ -586,9 +606,10 @@ MP_T *shorten_mp (NODE_T * p, MP_T * z, int digs, MP_T * x, int digs_x)
   } else {
 // Reserve extra digs for proper rounding.
     ADDR_T pop_sp = A68_SP;
+    size_t pop_scratch = A68_MP (mp_scratch_top);
     int digs_h = digs + 2;
     BOOL_T negative = (BOOL_T) (MP_DIGIT (x, 1) < 0);
-    MP_T *w = nil_mp (p, digs_h);
+    MP_T *w = scratch_mp (p, digs_h);
     if (negative) {
       MP_DIGIT (x, 1) = -MP_DIGIT (x, 1);
     }
@@ -600,6 +621,7 @@ MP_T *shorten_mp (NODE_T * p, MP_T * z, int digs, MP_T * x, int digs_x)
     if (negative) {
       MP_DIGIT (z, 1) = -MP_DIGIT (z, 1);
     }
+    A68_MP (mp_scratch_top) = pop_scratch;
     A68_SP = pop_sp;
     return z;
   }
@@ -641,6 +663,7 @@ MP_T *add_mp (NODE_T * p, MP_T * z, MP_T * x, MP_T * y, int digs)
   }
 // We want positive arguments.
   ADDR_T pop_sp = A68_SP;
+  size_t pop_scratch = A68_MP (mp_scratch_top);
   MP_T x_1 = MP_DIGIT (x, 1), y_1 = MP_DIGIT (y, 1);
   MP_DIGIT (x, 1) = ABS (x_1);
   MP_DIGIT (y, 1) = ABS (y_1);
@@ -654,7 +677,8 @@ MP_T *add_mp (NODE_T * p, MP_T * z, MP_T * x, MP_T * y, int digs)
   } else {
 // Add.
     int digs_h = 2 + digs;
-    MP_T *w = nil_mp (p, digs_h);
+    MP_T *w = scratch_mp (p, digs_h);
+    MP_DIGIT (w, 1) = (MP_T) 0;
     if (MP_EXPONENT (x) == MP_EXPONENT (y)) {
       MP_EXPONENT (w) = (MP_T) 1 + MP_EXPONENT (x);
       for (int j = 1; j <= digs; j++) {
@@ -685,6 +709,7 @@ MP_T *add_mp (NODE_T * p, MP_T * z, MP_T * x, MP_T * y, int digs)
     check_mp_exp (p, z);
   }
 // Restore and exit.
+  A68_MP (mp_scratch_top) = pop_scratch;
   A68_SP = pop_sp;
   MP_T z_1 = MP_DIGIT (z, 1);
   MP_DIGIT (x, 1) = x_1;
@@ -709,6 +734,7 @@ MP_T *sub_mp (NODE_T * p, MP_T * z, MP_T * x, MP_T * y, int digs)
   }
 // We want positive arguments.
   ADDR_T pop_sp = A68_SP;
+  size_t pop_scratch = A68_MP (mp_scratch_top);
   MP_T x_1 = MP_DIGIT (x, 1), y_1 = MP_DIGIT (y, 1);
   MP_DIGIT (x, 1) = ABS (x_1);
   MP_DIGIT (y, 1) = ABS (y_1);
@@ -723,7 +749,8 @@ MP_T *sub_mp (NODE_T * p, MP_T * z, MP_T * x, MP_T * y, int digs)
 // Subtract.
     BOOL_T negative = A68_FALSE;
     int fnz, digs_h = 2 + digs;
-    MP_T *w = nil_mp (p, digs_h);
+    MP_T *w = scratch_mp (p, digs_h);
+    MP_DIGIT (w, 1) = (MP_T) 0;
     if (MP_EXPONENT (x) == MP_EXPONENT (y)) {
       MP_EXPONENT (w) = (MP_T) 1 + MP_EXPONENT (x);
       for (int j = 1; j <= digs; j++) {
@@ -788,6 +815,7 @@ MP_T *sub_mp (NODE_T * p, MP_T * z, MP_T * x, MP_T * y, int digs)
     check_mp_exp (p, z);
   }
 // Restore and exit.
+  A68_MP (mp_scratch_top) = pop_scratch;
   A68_SP = pop_sp;
   MP_T z_1 = MP_DIGIT (z, 1);
   MP_DIGIT (x, 1) = x_1;
@@ -796,6 +824,68 @@ MP_T *sub_mp (NODE_T * p, MP_T * z, MP_T * x, MP_T * y, int digs)
   return z;
 }
 
+//! @brief Set "z" to z + x, in place where possible.
+
+MP_T *plusab_mp (NODE_T * p, MP_T * z, MP_T * x, int digs)
+{
+// Gives the same digits as add_mp (p, z, z, x, digs) without a work copy,
+// for the common case in series summation where |z| dominates.
+  MP_T z_1 = MP_DIGIT (z, 1), x_1 = MP_DIGIT (x, 1);
+  if (x_1 == (MP_T) 0 || z_1 == (MP_T) 0 || z == x || (z_1 < 0) != (x_1 < 0) || MP_EXPONENT (x) > MP_EXPONENT (z)) {
+    return add_mp (p, z, z, x, digs);
+  }
+  MP_STATUS (z) = (MP_T) INIT_MASK;
+  MP_DIGIT (z, 1) = ABS (z_1);
+  MP_DIGIT (x, 1) = ABS (x_1);
+  int shl = (int) (MP_EXPONENT (z) - MP_EXPONENT (x));
+  MP_T guard = (shl >= 1 && shl <= digs ? MP_DIGIT (x, digs + 1 - shl) : (MP_T) 0), carry = (MP_T) 0;
+  for (int j = digs; j >= 1; j--) {
+    MP_T v = MP_DIGIT (z, j) + carry + (j > shl ? MP_DIGIT (x, j - shl) : (MP_T) 0);
+    if (v >= (MP_T) MP_RADIX) {
+      v -= (MP_T) MP_RADIX;
+      carry = (MP_T) 1;
+    } else {
+      carry = (MP_T) 0;
+    }
+    MP_DIGIT (z, j) = v;
+  }
+  MP_DIGIT (x, 1) = x_1;
+// Round to "digs" digits.
+  if (carry == (MP_T) 0) {
+    if (guard >= (MP_T) (MP_RADIX / 2)) {
+      int j = digs;
+      while (j >= 1 && ++MP_DIGIT (z, j) >= (MP_T) MP_RADIX) {
+        MP_DIGIT (z, j--) = (MP_T) 0;
+      }
+      if (j == 0) {
+        MP_DIGIT (z, 1) = (MP_T) 1;
+        MP_EXPONENT (z)++;
+      }
+    }
+  } else {
+    guard = MP_DIGIT (z, digs);
+    for (int j = digs; j >= 2; j--) {
+      MP_DIGIT (z, j) = MP_DIGIT (z, j - 1);
+    }
+    MP_DIGIT (z, 1) = carry;
+    if (guard >= (MP_T) (MP_RADIX / 2)) {
+      int j = digs;
+      while (j >= 2 && ++MP_DIGIT (z, j) >= (MP_T) MP_RADIX) {
+        MP_DIGIT (z, j--) = (MP_T) 0;
+      }
+      if (j == 1) {
+        MP_DIGIT (z, 1)++;
+      }
+    }
+    MP_EXPONENT (z)++;
+  }
+  check_mp_exp (p, z);
+  if (z_1 < 0) {
+    MP_DIGIT (z, 1) = -MP_DIGIT (z, 1);
+  }
+  return z;
+}
+
 //! @brief Set "z" to the product of "x" and "y".
 
 MP_T *mul_mp (NODE_T * p, MP_T * z, MP_T * x, MP_T * y, int digs)
@@ -804,32 +894,39 @@ MP_T *mul_mp (NODE_T * p, MP_T * z, MP_T * x, MP_T * y, int digs)
     SET_MP_ZERO (z, digs);
     return z;
   }
-// Grammar school algorithm with intermittent normalisation.
   ADDR_T pop_sp = A68_SP;
+  size_t pop_scratch = A68_MP (mp_scratch_top);
   int digs_h = 2 + digs;
   MP_T x_1 = MP_DIGIT (x, 1), y_1 = MP_DIGIT (y, 1);
   MP_DIGIT (x, 1) = ABS (x_1);
   MP_DIGIT (y, 1) = ABS (y_1);
   MP_STATUS (z) = (MP_T) INIT_MASK;
-  MP_T *w = lit_mp (p, 0, MP_EXPONENT (x) + MP_EXPONENT (y) + 1, digs_h);
-  int oflow = (int) FLOOR_MP ((MP_REAL_T) MAX_REPR_INT / (2 * MP_REAL_RADIX * MP_REAL_RADIX)) - 1;
-  for (int i = digs; i >= 1; i--) {
-    MP_T yi = MP_DIGIT (y, i);
-    if (yi != 0) {
-      int k = digs_h - i;
-      int j = (k > digs ? digs : k);
-      MP_T *u = &MP_DIGIT (w, i + j), *v = &MP_DIGIT (x, j);
-      if ((digs - i + 1) % oflow == 0) {
-        norm_mp (w, 2, digs_h);
-      }
-      while (j-- >= 1) {
-        (u--)[0] += yi * (v--)[0];
+  MP_T *w = set_mp (scratch_mp (p, digs_h), 0, MP_EXPONENT (x) + MP_EXPONENT (y) + 1, digs_h);
+  if (digs >= MP_FAST_DIGITS) {
+// Subquadratic full product.
+    mul_mp_fast (&MP_DIGIT (w, 1), &MP_DIGIT (x, 1), &MP_DIGIT (y, 1), digs, digs_h);
+  } else {
+// Grammar school algorithm with intermittent normalisation.
+    int oflow = (int) FLOOR_MP ((MP_REAL_T) MAX_REPR_INT / (2 * MP_REAL_RADIX * MP_REAL_RADIX)) - 1;
+    for (int i = digs; i >= 1; i--) {
+      MP_T yi = MP_DIGIT (y, i);
+      if (yi != 0) {
+        int k = digs_h - i;
+        int j = (k > digs ? digs : k);
+        MP_T *u = &MP_DIGIT (w, i + j), *v = &MP_DIGIT (x, j);
+        if ((digs - i + 1) % oflow == 0) {
+          norm_mp (w, 2, digs_h);
+        }
+        while (j-- >= 1) {
+          (u--)[0] += yi * (v--)[0];
+        }
       }
     }
+    norm_mp (w, 2, digs_h);
   }
-  norm_mp (w, 2, digs_h);
   round_internal_mp (z, w, digs);
 // Restore and exit.
+  A68_MP (mp_scratch_top) = pop_scratch;
   A68_SP = pop_sp;
   MP_T z_1 = MP_DIGIT (z, 1);
   MP_DIGIT (x, 1) = x_1;
@@ -852,7 +949,8 @@ MP_T *div_mp (NODE_T * p, MP_T * z, MP_T * x, MP_T * y, int digs)
 // most of the intermediate normalisation and recovering from wrong
 // guesses without separate correction steps.
 // Depending on application, div_mp cost is circa 3 times that of mul_mp.
-// Therefore Newton-Raphson division makes no sense here.
+// Therefore Newton-Raphson division only pays off for many digits, when
+// mul_mp is subquadratic.
   if (IS_ZERO_MP (y)) {
     errno = ERANGE;
     return NaN_MP;
@@ -881,11 +979,28 @@ MP_T *div_mp (NODE_T * p, MP_T * z, MP_T * x, MP_T * y, int digs)
     check_mp_exp (p, z);
     return z;
   }
+  if (digs >= MP_NEWTON_DIGITS) {
+    (void) div_mp_newton (p, z, x, y, digs);
+    MP_STATUS (z) = (MP_T) INIT_MASK;
+    MP_T z_1 = MP_DIGIT (z, 1);
+    MP_DIGIT (x, 1) = x_1;
+    MP_DIGIT (y, 1) = y_1;
+    MP_DIGIT (z, 1) = ((x_1 * y_1) >= 0 ? z_1 : -z_1);
+    check_mp_exp (p, z);
+    return z;
+  }
 // Working nominator in which the quotient develops.
   ADDR_T pop_sp = A68_SP;
+  size_t pop_scratch = A68_MP (mp_scratch_top);
   int wdigs = 4 + digs;
-  MP_T *w = lit_mp (p, 0, MP_EXPONENT (x) - MP_EXPONENT (y), wdigs);
+  MP_T *w = scratch_mp (p, wdigs);
+  MP_STATUS (w) = (MP_T) INIT_MASK;
+  MP_EXPONENT (w) = MP_EXPONENT (x) - MP_EXPONENT (y);
+  MP_DIGIT (w, 1) = (MP_T) 0;
   (void) move_mp_part (&MP_DIGIT (w, 2), &MP_DIGIT (x, 1), digs);
+  for (int j = digs + 2; j <= wdigs; j++) {
+    MP_DIGIT (w, j) = (MP_T) 0;
+  }
 // Estimate the denominator. For small MP_RADIX add: MP_DIGIT (y, 4) / MP_REAL_RADIX.
   MP_REAL_T den = (MP_DIGIT (y, 1) * MP_REAL_RADIX + MP_DIGIT (y, 2)) * MP_REAL_RADIX + MP_DIGIT (y, 3);
   MP_T *t = &MP_DIGIT (w, 2);
@@ -915,6 +1030,7 @@ MP_T *div_mp (NODE_T * p, MP_T * z, MP_T * x, MP_T * y, int digs)
   norm_mp (w, 2, digs);
   round_internal_mp (z, w, digs);
 // Restore and exit.
+  A68_MP (mp_scratch_top) = pop_scratch;
   A68_SP = pop_sp;
   MP_T z_1 = MP_DIGIT (z, 1);
   MP_DIGIT (x, 1) = x_1;
@@ -974,6 +1090,7 @@ MP_T *mul_mp_digit (NODE_T * p, MP_T * z, MP_T * x, MP_T y, int digs)
   MP_T x_1 = MP_DIGIT (x, 1);
   int digs_h = 2 + digs;
   ADDR_T pop_sp = A68_SP;
+  size_t pop_scratch = A68_MP (mp_scratch_top);
   MP_DIGIT (x, 1) = ABS (x_1);
   MP_STATUS (z) = (MP_T) INIT_MASK;
   MP_T y_1 = y;
@@ -981,16 +1098,20 @@ MP_T *mul_mp_digit (NODE_T * p, MP_T * z, MP_T * x, MP_T y, int digs)
   if (y == 2) {
     (void) add_mp (p, z, x, x, digs);
   } else {
-    MP_T *w = lit_mp (p, 0, MP_EXPONENT (x) + 1, digs_h);
+    MP_T *w = scratch_mp (p, digs_h);
+    MP_STATUS (w) = (MP_T) INIT_MASK;
+    MP_EXPONENT (w) = MP_EXPONENT (x) + 1;
+    MP_DIGIT (w, 1) = MP_DIGIT (w, digs_h) = (MP_T) 0;
     MP_T *u = &MP_DIGIT (w, 1 + digs), *v = &MP_DIGIT (x, digs);
     int j = digs;
     while (j-- >= 1) {
-      (u--)[0] += y * (v--)[0];
+      (u--)[0] = y * (v--)[0];
     }
     norm_mp (w, 2, digs_h);
     round_internal_mp (z, w, digs);
   }
 // Restore and exit.
+  A68_MP (mp_scratch_top) = pop_scratch;
   A68_SP = pop_sp;
   MP_T z_1 = MP_DIGIT (z, 1);
   MP_DIGIT (x, 1) = x_1;
@@ -999,25 +1120,78 @@ MP_T *mul_mp_digit (NODE_T * p, MP_T * z, MP_T * x, MP_T y, int digs)
   return z;
 }
 
+//! @brief Set "z" to z * digit y, in place.
+
+MP_T *timesab_mp_digit (NODE_T * p, MP_T * z, MP_T y, int digs)
+{
+// Gives the same digits as mul_mp_digit (p, z, z, y, digs) without a work copy.
+  MP_T z_1 = MP_DIGIT (z, 1), y_1 = y;
+  y = ABS (y_1);
+  if (z_1 == (MP_T) 0 || y == (MP_T) 0 || y == (MP_T) 2) {
+    return mul_mp_digit (p, z, z, y_1, digs);
+  }
+  MP_STATUS (z) = (MP_T) INIT_MASK;
+  MP_DIGIT (z, 1) = ABS (z_1);
+  MP_T carry = (MP_T) 0;
+  for (int j = digs; j >= 1; j--) {
+    MP_T v = y * MP_DIGIT (z, j) + carry;
+    if (v >= (MP_T) MP_RADIX) {
+      carry = (MP_T) ((MP_INT_T) (v / (MP_T) MP_RADIX));
+      v -= carry * (MP_T) MP_RADIX;
+    } else {
+      carry = (MP_T) 0;
+    }
+    MP_DIGIT (z, j) = v;
+  }
+// Round to "digs" digits.
+  if (carry != (MP_T) 0) {
+    MP_T guard = MP_DIGIT (z, digs);
+    for (int j = digs; j >= 2; j--) {
+      MP_DIGIT (z, j) = MP_DIGIT (z, j - 1);
+    }
+    MP_DIGIT (z, 1) = carry;
+    if (guard >= (MP_T) (MP_RADIX / 2)) {
+      int j = digs;
+      while (j >= 2 && ++MP_DIGIT (z, j) >= (MP_T) MP_RADIX) {
+        MP_DIGIT (z, j--) = (MP_T) 0;
+      }
+      if (j == 1) {
+        MP_DIGIT (z, 1)++;
+      }
+    }
+    MP_EXPONENT (z)++;
+  }
+  check_mp_exp (p, z);
+  if ((z_1 * y_1) < 0) {
+    MP_DIGIT (z, 1) = -MP_DIGIT (z, 1);
+  }
+  return z;
+}
+
 //! @brief Set "z" to x/2.
 
 MP_T *half_mp (NODE_T * p, MP_T * z, MP_T * x, int digs)
 {
   ADDR_T pop_sp = A68_SP;
+  size_t pop_scratch = A68_MP (mp_scratch_top);
   int digs_h = 2 + digs;
   MP_T x_1 = MP_DIGIT (x, 1);
   MP_DIGIT (x, 1) = ABS (x_1);
   MP_STATUS (z) = (MP_T) INIT_MASK;
 // Calculate x * 0.5.
-  MP_T *w = lit_mp (p, 0, MP_EXPONENT (x), digs_h);
+  MP_T *w = scratch_mp (p, digs_h);
+  MP_STATUS (w) = (MP_T) INIT_MASK;
+  MP_EXPONENT (w) = MP_EXPONENT (x);
+  MP_DIGIT (w, 1) = MP_DIGIT (w, digs_h) = (MP_T) 0;
   MP_T *u = &MP_DIGIT (w, 1 + digs), *v = &MP_DIGIT (x, digs);
   int j = digs;
   while (j-- >= 1) {
-    (u--)[0] += (MP_RADIX / 2) * (v--)[0];
+    (u--)[0] = (MP_RADIX / 2) * (v--)[0];
   }
   norm_mp (w, 2, digs_h);
   round_internal_mp (z, w, digs);
 // Restore and exit.
+  A68_MP (mp_scratch_top) = pop_scratch;
   A68_SP = pop_sp;
   MP_T z_1 = MP_DIGIT (z, 1);
   MP_DIGIT (x, 1) = x_1;
@@ -1031,20 +1205,25 @@ MP_T *half_mp (NODE_T * p, MP_T * z, MP_T * x, int digs)
 MP_T *tenth_mp (NODE_T * p, MP_T * z, MP_T * x, int digs)
 {
   ADDR_T pop_sp = A68_SP;
+  size_t pop_scratch = A68_MP (mp_scratch_top);
   int digs_h = 2 + digs;
   MP_T x_1 = MP_DIGIT (x, 1);
   MP_DIGIT (x, 1) = ABS (x_1);
   MP_STATUS (z) = (MP_T) INIT_MASK;
 // Calculate x * 0.1.
-  MP_T *w = lit_mp (p, 0, MP_EXPONENT (x), digs_h);
+  MP_T *w = scratch_mp (p, digs_h);
+  MP_STATUS (w) = (MP_T) INIT_MASK;
+  MP_EXPONENT (w) = MP_EXPONENT (x);
+  MP_DIGIT (w, 1) = MP_DIGIT (w, digs_h) = (MP_T) 0;
   MP_T *u = &MP_DIGIT (w, 1 + digs), *v = &MP_DIGIT (x, digs);
   int j = digs;
   while (j-- >= 1) {
-    (u--)[0] += (MP_RADIX / 10) * (v--)[0];
+    (u--)[0] = (MP_RADIX / 10) * (v--)[0];
   }
   norm_mp (w, 2, digs_h);
   round_internal_mp (z, w, digs);
 // Restore and exit.
+  A68_MP (mp_scratch_top) = pop_scratch;
   A68_SP = pop_sp;
   MP_T z_1 = MP_DIGIT (z, 1);
   MP_DIGIT (x, 1) = x_1;
@@ -1069,6 +1248,7 @@ MP_T *div_mp_digit (NODE_T * p, MP_T * z, MP_T * x, MP_T y, int digs)
 #endif
 // Work with positive operands.
   ADDR_T pop_sp = A68_SP;
+  size_t pop_scratch = A68_MP (mp_scratch_top);
   MP_T x_1 = MP_DIGIT (x, 1), y_1 = y;
   MP_DIGIT (x, 1) = ABS (x_1);
   MP_STATUS (z) = (MP_T) INIT_MASK;
@@ -1079,8 +1259,14 @@ MP_T *div_mp_digit (NODE_T * p, MP_T * z, MP_T * x, MP_T y, int digs)
     (void) tenth_mp (p, z, x, digs);
   } else {
     int wdigs = 4 + digs;
-    MP_T *w = lit_mp (p, 0, MP_EXPONENT (x), wdigs);
+    MP_T *w = scratch_mp (p, wdigs);
+    MP_STATUS (w) = (MP_T) INIT_MASK;
+    MP_EXPONENT (w) = MP_EXPONENT (x);
+    MP_DIGIT (w, 1) = (MP_T) 0;
     (void) move_mp_part (&MP_DIGIT (w, 2), &MP_DIGIT (x, 1), digs);
+    for (int j = digs + 2; j <= wdigs; j++) {
+      MP_DIGIT (w, j) = (MP_T) 0;
+    }
 // Estimate the denominator.
     MP_REAL_T den = (MP_REAL_T) y * MP_REAL_RADIX * MP_REAL_RADIX;
     MP_T *t = &MP_DIGIT (w, 2);
@@ -1098,6 +1284,7 @@ MP_T *div_mp_digit (NODE_T * p, MP_T * z, MP_T * x, MP_T y, int digs)
     round_internal_mp (z, w, digs);
   }
 // Restore and exit.
+  A68_MP (mp_scratch_top) = pop_scratch;
   A68_SP = pop_sp;
   MP_T z_1 = MP_DIGIT (z, 1);
   MP_DIGIT (x, 1) = x_1;
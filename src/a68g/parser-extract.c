@@ -82,19 +82,11 @@ int find_tag_definition (TABLE_T * table, char *name)
 {
   if (table != NO_TABLE) {
     int ret = 0;
-    BOOL_T found = A68_FALSE;
-    for (TAG_T *s = INDICANTS (table); s != NO_TAG && !found; FORWARD (s)) {
-      if (NSYMBOL (NODE (s)) == name) {
-        ret += INDICANT;
-        found = A68_TRUE;
-      }
+    if (find_tag_local (table, INDICANT, name) != NO_TAG) {
+      ret += INDICANT;
     }
-    found = A68_FALSE;
-    for (TAG_T *s = OPERATORS (table); s != NO_TAG && !found; FORWARD (s)) {
-      if (NSYMBOL (NODE (s)) == name) {
-        ret += OPERATOR;
-        found = A68_TRUE;
-      }
+    if (find_tag_local (table, OP_SYMBOL, name) != NO_TAG) {
+      ret += OPERATOR;
     }
     if (ret == 0) {
       return find_tag_definition (PREVIOUS (table), name);
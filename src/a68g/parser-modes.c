@@ -25,6 +25,7 @@
 
 #include "a68g.h"
 #include "a68g-postulates.h"
+#include "a68g-moids.h"
 #include "a68g-parser.h"
 
 // Mode collection, equivalencing and derived modes.
@@ -105,13 +106,116 @@ void renumber_moids (MOID_T * p, int n)
   }
 }
 
+//! @brief Signature of a component mode, shared by equivalent components.
+
+static unt component_signature (MOID_T * m)
+{
+  if (m == NO_MOID) {
+    return 0;
+  } else if (IS (m, STANDARD)) {
+    return (unt) ((uintptr_t) m >> 4);
+  } else {
+    return (unt) ATTRIBUTE (m);
+  }
+}
+
+//! @brief Signature of a mode, shared by equivalent modes.
+
+static unt mode_signature (MOID_T * m)
+{
+// Equivalent modes have same attribute and dimension, and so do their
+// components; a standard mode is only equivalent to itself.
+  unt h = (unt) ATTRIBUTE (m) * 31 + (unt) DIM (m);
+  if (IS (m, STANDARD)) {
+    return h * 31 + component_signature (m);
+  }
+  h = h * 31 + component_signature (SUB (m));
+  if (!IS (m, UNION_SYMBOL) && !IS (m, INDICANT)) {
+    for (PACK_T *p = PACK (m); p != NO_PACK; FORWARD (p)) {
+      h = h * 31 + component_signature (MOID (p));
+      h = h * 31 + (unt) ((uintptr_t) TEXT (p) >> 4);
+    }
+  }
+  return h ^ (h >> 15);
+}
+
+//! @brief Enter mode in the mode index.
+
+static void enter_mode_index (MOID_T * m)
+{
+  if (2 * (A68_PARSER (mode_index_used) + 1) > A68_PARSER (mode_index_size)) {
+    MOID_T **old = A68_PARSER (mode_index);
+    int old_size = A68_PARSER (mode_index_size);
+    A68_PARSER (mode_index_size) = 2 * old_size;
+    A68_PARSER (mode_index_used) = 0;
+    A68_PARSER (mode_index) = (MOID_T **) a68_alloc ((size_t) A68_PARSER (mode_index_size) * sizeof (MOID_T *), __func__, __LINE__);
+    for (int k = 0; k < A68_PARSER (mode_index_size); k++) {
+      A68_PARSER (mode_index)[k] = NO_MOID;
+    }
+    for (int k = 0; k < old_size; k++) {
+      if (old[k] != NO_MOID) {
+        enter_mode_index (old[k]);
+      }
+    }
+    a68_free (old);
+  }
+  int mask = A68_PARSER (mode_index_size) - 1, k = (int) (mode_signature (m) & (unt) mask);
+  while (A68_PARSER (mode_index)[k] != NO_MOID) {
+    k = (k + 1) & mask;
+  }
+  A68_PARSER (mode_index)[k] = m;
+  A68_PARSER (mode_index_used)++;
+}
+
+//! @brief Switch the mode index on or off.
+
+void index_modes (BOOL_T on)
+{
+// While the standard environ is built, modes are only added and never
+// rewritten, so a mode can be found by its signature instead of a scan
+// of the whole mode table.
+  if (A68_PARSER (mode_index) != NO_VAR) {
+    a68_free (A68_PARSER (mode_index));
+    A68_PARSER (mode_index) = NO_VAR;
+  }
+  if (on) {
+    A68_PARSER (mode_index_size) = 1024;
+    A68_PARSER (mode_index_used) = 0;
+    A68_PARSER (mode_index) = (MOID_T **) a68_alloc ((size_t) A68_PARSER (mode_index_size) * sizeof (MOID_T *), __func__, __LINE__);
+    for (int k = 0; k < A68_PARSER (mode_index_size); k++) {
+      A68_PARSER (mode_index)[k] = NO_MOID;
+    }
+    for (MOID_T *m = TOP_MOID (&A68_JOB); m != NO_MOID; FORWARD (m)) {
+      enter_mode_index (m);
+    }
+  }
+}
+
 //! @brief Register mode in the global mode table, if mode is unique.
 
 MOID_T *register_extra_mode (MOID_T ** z, MOID_T * u)
 {
+  if (A68_PARSER (mode_index) != NO_VAR) {
+    unt h = mode_signature (u);
+    int mask = A68_PARSER (mode_index_size) - 1;
+    for (int k = (int) (h & (unt) mask); A68_PARSER (mode_index)[k] != NO_MOID; k = (k + 1) & mask) {
+      MOID_T *m = A68_PARSER (mode_index)[k];
+      if (mode_signature (m) == h && prove_moid_equivalence (m, u)) {
+        return m;
+      }
+    }
+    NUMBER (u) = A68 (mode_count)++;
+    NEXT (u) = (*z);
+    enter_mode_index (u);
+    return *z = u;
+  }
   // If we already know this mode, return the existing entry; otherwise link it in.
+  // Modes of different attribute or dimension are never equivalent, so only
+  // candidates that pass that cheap test go through a proof.
   for (MOID_T *head = TOP_MOID (&A68_JOB); head != NO_MOID; FORWARD (head)) {
-    if (prove_moid_equivalence (head, u)) {
+    if (head != u && (ATTRIBUTE (head) != ATTRIBUTE (u) || DIM (head) != DIM (u))) {
+      continue;
+    } else if (prove_moid_equivalence (head, u)) {
       return head;
     }
   }
@@ -1059,4 +1163,5 @@ void make_moid_list (MODULE_T * mod)
   }
   compute_derived_modes (mod);
   init_postulates ();
+  init_coercion_memo ();
 }
@@ -750,25 +750,24 @@ void mode_check_enclosed (NODE_T * p, SOID_T * x, SOID_T * y)
 
 //! @brief Search table for operator.
 
-TAG_T *search_table_for_operator (TAG_T * t, const char *n, MOID_T * x, MOID_T * y)
+TAG_T *search_table_for_operator (TABLE_T * s, const char *n, MOID_T * x, MOID_T * y)
 {
   if (is_mode_isnt_well (x)) {
     return A68_PARSER (error_tag);
   } else if (y != NO_MOID && is_mode_isnt_well (y)) {
     return A68_PARSER (error_tag);
   }
-  for (; t != NO_TAG; FORWARD (t)) {
-    if (NSYMBOL (NODE (t)) == n) {
-      PACK_T *p = PACK (MOID (t));
-      if (is_coercible (x, MOID (p), FIRM, ALIAS_DEFLEXING)) {
-        FORWARD (p);
-        if (p == NO_PACK && y == NO_MOID) {
+// Only operators with symbol "n" are candidates.
+  for (TAG_T *t = find_tag_local (s, OP_SYMBOL, n); t != NO_TAG; t = next_tag_local (s, OP_SYMBOL, t)) {
+    PACK_T *p = PACK (MOID (t));
+    if (is_coercible (x, MOID (p), FIRM, ALIAS_DEFLEXING)) {
+      FORWARD (p);
+      if (p == NO_PACK && y == NO_MOID) {
 // Matched in case of a monadic.
-          return t;
-        } else if (p != NO_PACK && y != NO_MOID && is_coercible (y, MOID (p), FIRM, ALIAS_DEFLEXING)) {
+        return t;
+      } else if (p != NO_PACK && y != NO_MOID && is_coercible (y, MOID (p), FIRM, ALIAS_DEFLEXING)) {
 // Matched in case of a dyadic.
-          return t;
-        }
+        return t;
       }
     }
   }
@@ -785,7 +784,7 @@ TAG_T *search_table_chain_for_operator (TABLE_T * s, char *n, MOID_T * x, MOID_T
     return A68_PARSER (error_tag);
   }
   while (s != NO_TABLE) {
-    TAG_T *z = search_table_for_operator (OPERATORS (s), n, x, y);
+    TAG_T *z = search_table_for_operator (s, n, x, y);
     if (z != NO_TAG) {
       return z;
     }
@@ -816,19 +815,19 @@ TAG_T *find_operator (TABLE_T * s, char *n, MOID_T * x, MOID_T * y)
     } else {
 // (B.2) A little trick to allow - (0, 1) or ABS (1, long pi).
       if (is_coercible (x, M_COMPLEX, STRONG, SAFE_DEFLEXING)) {
-        z = search_table_for_operator (OPERATORS (A68_STANDENV), n, M_COMPLEX, NO_MOID);
+        z = search_table_for_operator (A68_STANDENV, n, M_COMPLEX, NO_MOID);
         if (z != NO_TAG) {
           return z;
         }
       }
       if (is_coercible (x, M_LONG_COMPLEX, STRONG, SAFE_DEFLEXING)) {
-        z = search_table_for_operator (OPERATORS (A68_STANDENV), n, M_LONG_COMPLEX, NO_MOID);
+        z = search_table_for_operator (A68_STANDENV, n, M_LONG_COMPLEX, NO_MOID);
         if (z != NO_TAG) {
           return z;
         }
       }
       if (is_coercible (x, M_LONG_LONG_COMPLEX, STRONG, SAFE_DEFLEXING)) {
-        z = search_table_for_operator (OPERATORS (A68_STANDENV), n, M_LONG_LONG_COMPLEX, NO_MOID);
+        z = search_table_for_operator (A68_STANDENV, n, M_LONG_LONG_COMPLEX, NO_MOID);
       }
     }
     return NO_TAG;
@@ -846,30 +845,30 @@ TAG_T *find_operator (TABLE_T * s, char *n, MOID_T * x, MOID_T * y)
       || (u == M_ROW_COMPLEX || u == M_ROW_ROW_COMPLEX)
       || (v == M_ROW_COMPLEX || v == M_ROW_ROW_COMPLEX)) {
     if (u == M_INT) {
-      z = search_table_for_operator (OPERATORS (A68_STANDENV), n, M_REAL, y);
+      z = search_table_for_operator (A68_STANDENV, n, M_REAL, y);
       if (z != NO_TAG) {
         return z;
       }
-      z = search_table_for_operator (OPERATORS (A68_STANDENV), n, M_COMPLEX, y);
+      z = search_table_for_operator (A68_STANDENV, n, M_COMPLEX, y);
       if (z != NO_TAG) {
         return z;
       }
     } else if (v == M_INT) {
-      z = search_table_for_operator (OPERATORS (A68_STANDENV), n, x, M_REAL);
+      z = search_table_for_operator (A68_STANDENV, n, x, M_REAL);
       if (z != NO_TAG) {
         return z;
       }
-      z = search_table_for_operator (OPERATORS (A68_STANDENV), n, x, M_COMPLEX);
+      z = search_table_for_operator (A68_STANDENV, n, x, M_COMPLEX);
       if (z != NO_TAG) {
         return z;
       }
     } else if (u == M_REAL) {
-      z = search_table_for_operator (OPERATORS (A68_STANDENV), n, M_COMPLEX, y);
+      z = search_table_for_operator (A68_STANDENV, n, M_COMPLEX, y);
       if (z != NO_TAG) {
         return z;
       }
     } else if (v == M_REAL) {
-      z = search_table_for_operator (OPERATORS (A68_STANDENV), n, x, M_COMPLEX);
+      z = search_table_for_operator (A68_STANDENV, n, x, M_COMPLEX);
       if (z != NO_TAG) {
         return z;
       }
@@ -879,49 +878,49 @@ TAG_T *find_operator (TABLE_T * s, char *n, MOID_T * x, MOID_T * y)
   u = make_series_from_moids (x, y);
   u = make_united_mode (u);
   v = get_balanced_mode (u, STRONG, NO_DEPREF, SAFE_DEFLEXING);
-  z = search_table_for_operator (OPERATORS (A68_STANDENV), n, v, v);
+  z = search_table_for_operator (A68_STANDENV, n, v, v);
   if (z != NO_TAG) {
     return z;
   }
   if (is_coercible_series (u, M_REAL, STRONG, SAFE_DEFLEXING)) {
-    z = search_table_for_operator (OPERATORS (A68_STANDENV), n, M_REAL, M_REAL);
+    z = search_table_for_operator (A68_STANDENV, n, M_REAL, M_REAL);
     if (z != NO_TAG) {
       return z;
     }
   }
   if (is_coercible_series (u, M_LONG_REAL, STRONG, SAFE_DEFLEXING)) {
-    z = search_table_for_operator (OPERATORS (A68_STANDENV), n, M_LONG_REAL, M_LONG_REAL);
+    z = search_table_for_operator (A68_STANDENV, n, M_LONG_REAL, M_LONG_REAL);
     if (z != NO_TAG) {
       return z;
     }
   }
   if (is_coercible_series (u, M_LONG_LONG_REAL, STRONG, SAFE_DEFLEXING)) {
-    z = search_table_for_operator (OPERATORS (A68_STANDENV), n, M_LONG_LONG_REAL, M_LONG_LONG_REAL);
+    z = search_table_for_operator (A68_STANDENV, n, M_LONG_LONG_REAL, M_LONG_LONG_REAL);
     if (z != NO_TAG) {
       return z;
     }
   }
   if (is_coercible_series (u, M_COMPLEX, STRONG, SAFE_DEFLEXING)) {
-    z = search_table_for_operator (OPERATORS (A68_STANDENV), n, M_COMPLEX, M_COMPLEX);
+    z = search_table_for_operator (A68_STANDENV, n, M_COMPLEX, M_COMPLEX);
     if (z != NO_TAG) {
       return z;
     }
   }
   if (is_coercible_series (u, M_LONG_COMPLEX, STRONG, SAFE_DEFLEXING)) {
-    z = search_table_for_operator (OPERATORS (A68_STANDENV), n, M_LONG_COMPLEX, M_LONG_COMPLEX);
+    z = search_table_for_operator (A68_STANDENV, n, M_LONG_COMPLEX, M_LONG_COMPLEX);
     if (z != NO_TAG) {
       return z;
     }
   }
   if (is_coercible_series (u, M_LONG_LONG_COMPLEX, STRONG, SAFE_DEFLEXING)) {
-    z = search_table_for_operator (OPERATORS (A68_STANDENV), n, M_LONG_LONG_COMPLEX, M_LONG_LONG_COMPLEX);
+    z = search_table_for_operator (A68_STANDENV, n, M_LONG_LONG_COMPLEX, M_LONG_LONG_COMPLEX);
     if (z != NO_TAG) {
       return z;
     }
   }
 // (C.4) Now allow for depreffing for REF REAL +:= INT and alike.
   v = get_balanced_mode (u, STRONG, DEPREF, SAFE_DEFLEXING);
-  z = search_table_for_operator (OPERATORS (A68_STANDENV), n, v, v);
+  z = search_table_for_operator (A68_STANDENV, n, v, v);
   if (z != NO_TAG) {
     return z;
   }
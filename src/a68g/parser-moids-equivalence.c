@@ -58,7 +58,13 @@ BOOL_T is_united_subset (PACK_T * s, PACK_T * t)
   for (PACK_T *p = s; p != NO_PACK; FORWARD (p)) {
     BOOL_T f = A68_FALSE; 
     for (PACK_T *q = t; q != NO_PACK && !f; FORWARD (q)) {
+      POSTULATE_T *save = A68 (top_postulate);
       f = are_modes_equivalent (MOID (p), MOID (q));
+      if (!f) {
+// Withdraw postulates made while trying this alternative.
+        free_postulate_list (A68 (top_postulate), save);
+        A68 (top_postulate) = save;
+      }
     }
     if (!f) {
       return A68_FALSE;
@@ -74,36 +80,10 @@ BOOL_T are_united_packs_equivalent (PACK_T * s, PACK_T * t)
   return is_united_subset (s, t) && is_united_subset (t, s);
 }
 
-//! @brief Whether moids a and b are structurally equivalent.
+//! @brief Whether moids a and b of same attribute and dimension have equivalent structure.
 
-BOOL_T are_modes_equivalent (MOID_T * a, MOID_T * b)
+static BOOL_T are_structures_equivalent (MOID_T * a, MOID_T * b)
 {
-// Heuristics.
-  if (a == NO_MOID || b == NO_MOID) {
-// Modes can be NO_MOID in partial argument lists.
-    return A68_FALSE;
-  } else if (a == M_ERROR || b == M_ERROR) {
-    return A68_FALSE;
-  } else if (a == b) {
-    return A68_TRUE;
-  } else if (ATTRIBUTE (a) != ATTRIBUTE (b)) {
-    return A68_FALSE;
-  } else if (DIM (a) != DIM (b)) {
-    return A68_FALSE;
-  } else if (IS (a, STANDARD)) {
-    return (BOOL_T) (a == b);
-  } else if (EQUIVALENT (a) == b || EQUIVALENT (b) == a) {
-    return A68_TRUE;
-  } else if (is_postulated_pair (A68 (top_postulate), a, b) || is_postulated_pair (A68 (top_postulate), b, a)) {
-    return A68_TRUE;
-  } else if (IS (a, INDICANT)) {
-    if (NODE (a) == NO_NODE || NODE (b) == NO_NODE) {
-      return A68_FALSE;
-    } else {
-      return NODE (a) == NODE (b);
-    }
-  }
-// Investigate structure.
 // We now know that 'a' and 'b' have same attribute, dimension, ...
   if (IS (a, REF_SYMBOL)) {
 // REF MODE
@@ -119,8 +99,10 @@ BOOL_T are_modes_equivalent (MOID_T * a, MOID_T * b)
     POSTULATE_T *save = A68 (top_postulate);
     make_postulate (&A68 (top_postulate), a, b);
     BOOL_T z = are_packs_equivalent (PACK (a), PACK (b));
-    free_postulate_list (A68 (top_postulate), save);
-    A68 (top_postulate) = save;
+    if (!z) {
+      free_postulate_list (A68 (top_postulate), save);
+      A68 (top_postulate) = save;
+    }
     return z;
   } else if (IS (a, UNION_SYMBOL)) {
 // UNION (...)
@@ -136,8 +118,10 @@ BOOL_T are_modes_equivalent (MOID_T * a, MOID_T * b)
     if (z) {
       z = are_packs_equivalent (PACK (a), PACK (b));
     }
-    free_postulate_list (A68 (top_postulate), save);
-    A68 (top_postulate) = save;
+    if (!z) {
+      free_postulate_list (A68 (top_postulate), save);
+      A68 (top_postulate) = save;
+    }
     return z;
   } else if (IS (a, SERIES_MODE) || IS (a, STOWED_MODE)) {
 // Modes occurring in displays.
@@ -146,12 +130,56 @@ BOOL_T are_modes_equivalent (MOID_T * a, MOID_T * b)
   return A68_FALSE;
 }
 
+//! @brief Whether moids a and b are structurally equivalent.
+
+BOOL_T are_modes_equivalent (MOID_T * a, MOID_T * b)
+{
+// Heuristics.
+  if (a == NO_MOID || b == NO_MOID) {
+// Modes can be NO_MOID in partial argument lists.
+    return A68_FALSE;
+  } else if (a == M_ERROR || b == M_ERROR) {
+    return A68_FALSE;
+  } else if (a == b) {
+    return A68_TRUE;
+  } else if (ATTRIBUTE (a) != ATTRIBUTE (b)) {
+    return A68_FALSE;
+  } else if (DIM (a) != DIM (b)) {
+    return A68_FALSE;
+  } else if (IS (a, STANDARD)) {
+    return (BOOL_T) (a == b);
+  } else if (EQUIVALENT (a) == b || EQUIVALENT (b) == a) {
+    return A68_TRUE;
+  } else if (is_postulated_pair (a, b) || is_postulated_pair (b, a)) {
+    return A68_TRUE;
+  } else if (IS (a, INDICANT)) {
+    if (NODE (a) == NO_NODE || NODE (b) == NO_NODE) {
+      return A68_FALSE;
+    } else {
+      return NODE (a) == NODE (b);
+    }
+  } else if (A68 (top_postulate) == NO_POSTULATE) {
+// Without postulates no cycle is followed, so failures are not worth keeping.
+    return are_structures_equivalent (a, b);
+  } else if (is_disproved (a, b) || is_disproved (b, a)) {
+    return A68_FALSE;
+  } else if (are_structures_equivalent (a, b)) {
+    return A68_TRUE;
+  } else {
+    make_disproof (a, b);
+    return A68_FALSE;
+  }
+}
+
 //! @brief Whether two modes are structurally equivalent.
 
 BOOL_T prove_moid_equivalence (MOID_T * p, MOID_T * q)
 {
 // Prove two modes to be equivalent under assumption that they indeed are.
+// Postulates of successful subproofs stand until the proof is complete, so
+// no pair is proven twice; only a failing alternative withdraws its own.
   POSTULATE_T *save = A68 (top_postulate);
+  new_proof ();
   BOOL_T z = are_modes_equivalent (p, q);
   free_postulate_list (A68 (top_postulate), save);
   A68 (top_postulate) = save;
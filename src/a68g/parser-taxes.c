@@ -75,36 +75,182 @@ void tax_specifier_list (NODE_T *);
 void tax_parameter_list (NODE_T *);
 void tax_format_texts (NODE_T *);
 
-//! @brief Find a tag, searching symbol tables towards the root.
+// Symbols are unique strings, so tags are found by comparing pointers.
+// Short tag lists are searched linearly, longer ones through a hash index.
 
-int first_tag_global (TABLE_T * table, char *name)
+#define TAG_INDEX_MIN 16
+
+//! @brief Tag list for attribute "a" in "table", and where its index is kept.
+
+static TAG_T *tag_list (TABLE_T * table, int a, TAG_INDEX_T *** index)
 {
-  if (table != NO_TABLE) {
-    for (TAG_T *s = IDENTIFIERS (table); s != NO_TAG; FORWARD (s)) {
-      if (NSYMBOL (NODE (s)) == name) {
-        return IDENTIFIER;
-      }
+  switch (a) {
+  case IDENTIFIER: {
+      *index = &IDENTIFIER_INDEX (table);
+      return IDENTIFIERS (table);
     }
-    for (TAG_T *s = INDICANTS (table); s != NO_TAG; FORWARD (s)) {
-      if (NSYMBOL (NODE (s)) == name) {
-        return INDICANT;
-      }
+  case INDICANT: {
+      *index = &INDICANT_INDEX (table);
+      return INDICANTS (table);
     }
-    for (TAG_T *s = LABELS (table); s != NO_TAG; FORWARD (s)) {
-      if (NSYMBOL (NODE (s)) == name) {
-        return LABEL;
-      }
+  case LABEL: {
+      *index = &LABEL_INDEX (table);
+      return LABELS (table);
     }
-    for (TAG_T *s = OPERATORS (table); s != NO_TAG; FORWARD (s)) {
-      if (NSYMBOL (NODE (s)) == name) {
-        return OP_SYMBOL;
-      }
+  case OP_SYMBOL: {
+      *index = &OPERATOR_INDEX (table);
+      return OPERATORS (table);
+    }
+  case PRIO_SYMBOL: {
+      *index = &PRIORITY_INDEX (table);
+      return PRIO (table);
+    }
+  default: {
+      ABEND (A68_TRUE, ERROR_INTERNAL_CONSISTENCY, __func__);
+      return NO_TAG;
     }
-    for (TAG_T *s = PRIO (table); s != NO_TAG; FORWARD (s)) {
-      if (NSYMBOL (NODE (s)) == name) {
-        return PRIO_SYMBOL;
+  }
+}
+
+//! @brief Slot in "idx" for symbol "name".
+
+static TAG_T **tag_slot (TAG_INDEX_T * idx, const char *name)
+{
+  uint64_t h = (uint64_t) (uintptr_t) name >> 3;
+  h ^= h >> 29;
+  h *= (uint64_t) 0xbf58476d1ce4e5b9ULL;
+  h ^= h >> 32;
+  int mask = SIZE (idx) - 1, k = (int) (h & (uint64_t) mask);
+  while (SLOTS (idx)[k] != NO_TAG && NSYMBOL (NODE (SLOTS (idx)[k])) != name) {
+    k = (k + 1) & mask;
+  }
+  return &SLOTS (idx)[k];
+}
+
+//! @brief Make "size" empty slots for "idx".
+
+static void new_tag_slots (TAG_INDEX_T * idx, int size)
+{
+  SLOTS (idx) = (TAG_T **) a68_alloc ((size_t) size * sizeof (TAG_T *), __func__, __LINE__);
+  ABEND (SLOTS (idx) == NO_VAR, ERROR_OUT_OF_CORE, __func__);
+  for (int k = 0; k < size; k++) {
+    SLOTS (idx)[k] = NO_TAG;
+  }
+  SIZE (idx) = size;
+  USED (idx) = 0;
+}
+
+//! @brief Enter "z", which precedes all tags already in "idx".
+
+static void enter_tag_index (TAG_INDEX_T * idx, TAG_T * z)
+{
+  TAG_T **slot = tag_slot (idx, NSYMBOL (NODE (z)));
+  if (*slot == NO_TAG) {
+    USED (idx)++;
+  }
+  HOMONYM (z) = *slot;
+  *slot = z;
+  if (2 * USED (idx) > SIZE (idx)) {
+// Rehash the chains; their order does not change.
+    TAG_T **old = SLOTS (idx);
+    int size = SIZE (idx);
+    new_tag_slots (idx, 2 * size);
+    for (int k = 0; k < size; k++) {
+      if (old[k] != NO_TAG) {
+        *tag_slot (idx, NSYMBOL (NODE (old[k]))) = old[k];
+        USED (idx)++;
       }
     }
+    a68_free (old);
+  }
+}
+
+//! @brief Bring the index of "list" up to date.
+
+static TAG_INDEX_T *sync_tag_index (TAG_INDEX_T ** index, TAG_T * list)
+{
+  if (*index == NO_TAG_INDEX) {
+    *index = (TAG_INDEX_T *) a68_alloc (sizeof (TAG_INDEX_T), __func__, __LINE__);
+    ABEND (*index == NO_TAG_INDEX, ERROR_OUT_OF_CORE, __func__);
+    LIST (*index) = NO_TAG;
+// Indices hang off symbol tables in the fixed heap; chain them for a68_exit.
+    NEXT (*index) = A68_PARSER (tag_indices);
+    A68_PARSER (tag_indices) = *index;
+    new_tag_slots (*index, 4 * TAG_INDEX_MIN);
+  }
+  TAG_INDEX_T *idx = *index;
+  if (LIST (idx) != list) {
+// Tags are added at the head; enter the new ones, oldest first.
+    int n = 0;
+    TAG_T *s = list;
+    for (; s != NO_TAG && s != LIST (idx); FORWARD (s)) {
+      n++;
+    }
+    if (s != LIST (idx)) {
+      a68_free (SLOTS (idx));
+      new_tag_slots (idx, 4 * TAG_INDEX_MIN);
+    }
+    TAG_T **added = (TAG_T **) a68_alloc ((size_t) n * sizeof (TAG_T *), __func__, __LINE__);
+    ABEND (added == NO_VAR, ERROR_OUT_OF_CORE, __func__);
+    s = list;
+    for (int k = 0; k < n; k++, FORWARD (s)) {
+      added[k] = s;
+    }
+    for (int k = n - 1; k >= 0; k--) {
+      enter_tag_index (idx, added[k]);
+    }
+    a68_free (added);
+    LIST (idx) = list;
+  }
+  return idx;
+}
+
+//! @brief Free all tag indices.
+
+void free_tag_indices (void)
+{
+  while (A68_PARSER (tag_indices) != NO_TAG_INDEX) {
+    TAG_INDEX_T *idx = A68_PARSER (tag_indices);
+    A68_PARSER (tag_indices) = NEXT (idx);
+    a68_free (SLOTS (idx));
+    a68_free (idx);
+  }
+}
+
+//! @brief Next tag after "t" with the same symbol, in the local symbol table.
+
+TAG_T *next_tag_local (TABLE_T * table, int a, TAG_T * t)
+{
+  TAG_INDEX_T **index;
+  TAG_T *list = tag_list (table, a, &index);
+  if (*index != NO_TAG_INDEX) {
+    (void) sync_tag_index (index, list);
+    return HOMONYM (t);
+  }
+  for (TAG_T *s = NEXT (t); s != NO_TAG; FORWARD (s)) {
+    if (NSYMBOL (NODE (s)) == NSYMBOL (NODE (t))) {
+      return s;
+    }
+  }
+  return NO_TAG;
+}
+
+//! @brief Find a tag, searching symbol tables towards the root.
+
+int first_tag_global (TABLE_T * table, char *name)
+{
+  if (table != NO_TABLE) {
+    if (find_tag_local (table, IDENTIFIER, name) != NO_TAG) {
+      return IDENTIFIER;
+    } else if (find_tag_local (table, INDICANT, name) != NO_TAG) {
+      return INDICANT;
+    } else if (find_tag_local (table, LABEL, name) != NO_TAG) {
+      return LABEL;
+    } else if (find_tag_local (table, OP_SYMBOL, name) != NO_TAG) {
+      return OP_SYMBOL;
+    } else if (find_tag_local (table, PRIO_SYMBOL, name) != NO_TAG) {
+      return PRIO_SYMBOL;
+    }
     return first_tag_global (PREVIOUS (table), name);
   } else {
     return STOP;
@@ -444,9 +590,8 @@ void tax_generators (NODE_T * p)
 TAG_T *find_firmly_related_op (TABLE_T * c, const char *n, MOID_T * l, MOID_T * r, const TAG_T * self)
 {
   if (c != NO_TABLE) {
-    TAG_T *s = OPERATORS (c);
-    for (; s != NO_TAG; FORWARD (s)) {
-      if (s != self && NSYMBOL (NODE (s)) == n) {
+    for (TAG_T *s = find_tag_local (c, OP_SYMBOL, n); s != NO_TAG; s = next_tag_local (c, OP_SYMBOL, s)) {
+      if (s != self) {
         PACK_T *t = PACK (MOID (s));
         if (t != NO_PACK && is_firm (MOID (t), l)) {
 // catch monadic operator.
@@ -613,37 +758,9 @@ TAG_T *add_tag (TABLE_T * s, int a, NODE_T * n, MOID_T * m, int p)
 TAG_T *find_tag_global (TABLE_T * table, int a, char *name)
 {
   if (table != NO_TABLE) {
-    TAG_T *s = NO_TAG;
-    switch (a) {
-    case IDENTIFIER: {
-        s = IDENTIFIERS (table);
-        break;
-      }
-    case INDICANT: {
-        s = INDICANTS (table);
-        break;
-      }
-    case LABEL: {
-        s = LABELS (table);
-        break;
-      }
-    case OP_SYMBOL: {
-        s = OPERATORS (table);
-        break;
-      }
-    case PRIO_SYMBOL: {
-        s = PRIO (table);
-        break;
-      }
-    default: {
-        ABEND (A68_TRUE, ERROR_INTERNAL_CONSISTENCY, __func__);
-        break;
-      }
-    }
-    for (; s != NO_TAG; FORWARD (s)) {
-      if (NSYMBOL (NODE (s)) == name) {
-        return s;
-      }
+    TAG_T *s = find_tag_local (table, a, name);
+    if (s != NO_TAG) {
+      return s;
     }
     return find_tag_global (PREVIOUS (table), a, name);
   } else {
@@ -656,15 +773,10 @@ TAG_T *find_tag_global (TABLE_T * table, int a, char *name)
 int is_identifier_or_label_global (TABLE_T * table, char *name)
 {
   if (table != NO_TABLE) {
-    for (TAG_T *s = IDENTIFIERS (table); s != NO_TAG; FORWARD (s)) {
-      if (NSYMBOL (NODE (s)) == name) {
-        return IDENTIFIER;
-      }
-    }
-    for (TAG_T *s = LABELS (table); s != NO_TAG; FORWARD (s)) {
-      if (NSYMBOL (NODE (s)) == name) {
-        return LABEL;
-      }
+    if (find_tag_local (table, IDENTIFIER, name) != NO_TAG) {
+      return IDENTIFIER;
+    } else if (find_tag_local (table, LABEL, name) != NO_TAG) {
+      return LABEL;
     }
     return is_identifier_or_label_global (PREVIOUS (table), name);
   } else {
@@ -677,25 +789,21 @@ int is_identifier_or_label_global (TABLE_T * table, char *name)
 TAG_T *find_tag_local (TABLE_T * table, int a, const char *name)
 {
   if (table != NO_TABLE) {
-    TAG_T *s = NO_TAG;
-    if (a == OP_SYMBOL) {
-      s = OPERATORS (table);
-    } else if (a == PRIO_SYMBOL) {
-      s = PRIO (table);
-    } else if (a == IDENTIFIER) {
-      s = IDENTIFIERS (table);
-    } else if (a == INDICANT) {
-      s = INDICANTS (table);
-    } else if (a == LABEL) {
-      s = LABELS (table);
-    } else {
-      ABEND (A68_TRUE, ERROR_INTERNAL_CONSISTENCY, __func__);
-    }
-    for (; s != NO_TAG; FORWARD (s)) {
-      if (NSYMBOL (NODE (s)) == name) {
-        return s;
+    TAG_INDEX_T **index;
+    TAG_T *list = tag_list (table, a, &index);
+    if (*index == NO_TAG_INDEX) {
+      int n = 0;
+      TAG_T *s = list;
+      for (; s != NO_TAG && n < TAG_INDEX_MIN; FORWARD (s), n++) {
+        if (NSYMBOL (NODE (s)) == name) {
+          return s;
+        }
+      }
+      if (s == NO_TAG) {
+        return NO_TAG;
       }
     }
+    return *tag_slot (sync_tag_index (index, list), name);
   }
   return NO_TAG;
 }
@@ -667,6 +667,7 @@ GINFO_T *new_genie_info (void)
   IS_COERCION (z) = A68_FALSE;
   IS_NEW_LEXICAL_LEVEL (z) = A68_FALSE;
   NEED_DNS (z) = A68_FALSE;
+  IS_INITIALISED (z) = A68_FALSE;
   PARENT (z) = NO_NODE;
   OFFSET (z) = NO_BYTE;
   CONSTANT (z) = NO_CONSTANT;
@@ -675,6 +676,8 @@ GINFO_T *new_genie_info (void)
   SIZE (z) = 0;
   COMPILE_NAME (z) = NO_TEXT;
   COMPILE_NODE (z) = 0;
+  PROFILE (z) = NO_PROFILE;
+  BYTECODE (z) = NO_BYTECODE;
   return z;
 }
 
@@ -724,6 +727,11 @@ TABLE_T *new_symbol_table (TABLE_T * p)
   INDICANTS (z) = NO_TAG;
   LABELS (z) = NO_TAG;
   ANONYMOUS (z) = NO_TAG;
+  IDENTIFIER_INDEX (z) = NO_TAG_INDEX;
+  OPERATOR_INDEX (z) = NO_TAG_INDEX;
+  PRIORITY_INDEX (z) = NO_TAG_INDEX;
+  INDICANT_INDEX (z) = NO_TAG_INDEX;
+  LABEL_INDEX (z) = NO_TAG_INDEX;
   JUMP_TO (z) = NO_NODE;
   SEQUENCE (z) = NO_NODE;
   return z;
@@ -800,6 +808,7 @@ TAG_T *new_tag (void)
   LOC_ASSIGNED (z) = A68_FALSE;
   NEXT (z) = NO_TAG;
   BODY (z) = NO_TAG;
+  HOMONYM (z) = NO_TAG;
   PORTABLE (z) = A68_TRUE;
   NUMBER (z) = ++A68_PARSER (tag_number);
   return z;
@@ -314,7 +314,7 @@ BOOL_T basic_unit (NODE_T * p)
       NODE_T *dst = SUB_SUB (p);
       NODE_T *src = NEXT_NEXT (dst);
       NODE_T *slice = stems_from (dst, SLICE);
-      return (BOOL_T) (IS (MOID (slice), REF_SYMBOL) && basic_slice (slice) && basic_unit (src) && basic_mode_non_row (MOID (src)));
+      return (BOOL_T) (IS (MOID (slice), REF_SYMBOL) && MOID (SUB (slice)) != M_REF_STRING && basic_slice (slice) && basic_unit (src) && basic_mode_non_row (MOID (src)));
     } else if (IS (p, VOIDING) && IS (SUB (p), ASSIGNATION) && stems_from (SUB_SUB (p), SELECTION) != NO_NODE) {
       NODE_T *dst = SUB_SUB (p);
       NODE_T *src = NEXT_NEXT (dst);
@@ -337,7 +337,8 @@ BOOL_T basic_unit (NODE_T * p)
     } else if (IS (p, CAST)) {
       return (BOOL_T) (folder_mode (MOID (SUB (p))) && basic_unit (NEXT_SUB (p)));
     } else if (IS (p, SLICE)) {
-      return (BOOL_T) (basic_mode (MOID (p)) && basic_slice (p));
+// A name in a STRING is sliced by the genie, that unshares the row first.
+      return (BOOL_T) (basic_mode (MOID (p)) && !(IS_REF (MOID (p)) && MOID (SUB (p)) == M_REF_STRING) && basic_slice (p));
     } else if (IS (p, SELECTION)) {
       NODE_T *sec = stems_from (NEXT_SUB (p), IDENTIFIER);
       if (sec == NO_NODE) {
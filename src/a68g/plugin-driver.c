@@ -51,6 +51,178 @@ void plugin_driver_code (void)
   }
 }
 
+#if defined (BUILD_A68_COMPILER)
+
+// Compiled plugins are cached in a directory, under a name that hashes the
+// emitted code, the compiler command and the a68g build. Emitted code already
+// holds the program with its inclusions, so unchanged programs reuse their
+// plugin, also from other directories; comment lines, which name the source
+// file, are not hashed. On a miss, the objects of units emitted for included
+// files are looked up by their own hash, so only changed code is recompiled.
+
+//! @brief Hash emitted code in file "fn", skipping comment lines, into "h".
+
+static BOOL_T plugin_hash_object (uint64_t * h, int n, char *fn)
+{
+  FILE *f = fopen (fn, "r");
+  if (f == NO_FILE) {
+    return A68_FALSE;
+  }
+  BUFFER line;
+// fgets splits long lines; only a chunk that starts a line can be a comment line.
+  BOOL_T skip = A68_FALSE, bol = A68_TRUE;
+  while (fgets (line, BUFFER_SIZE, f) != NO_TEXT) {
+    size_t len = strlen (line);
+    if (bol) {
+      skip = (BOOL_T) (strncmp (line, "//", 2) == 0);
+    }
+    if (!skip) {
+      for (int k = 0; k < n; k++) {
+        h[k] = plugin_hash (h[k], line, len);
+      }
+    }
+    bol = (BOOL_T) (len > 0 && line[len - 1] == NEWLINE_CHAR);
+  }
+  ASSERT (fclose (f) == 0);
+  return A68_TRUE;
+}
+
+//! @brief Make directory "dn" unless it exists.
+
+static BOOL_T plugin_mkdir (char *dn)
+{
+  errno = 0;
+  if (mkdir (dn, (mode_t) (S_IRUSR | S_IWUSR | S_IXUSR)) != 0 && errno != EEXIST) {
+    return A68_FALSE;
+  }
+  struct stat status;
+  return (BOOL_T) (stat (dn, &status) == 0 && S_ISDIR (ST_MODE (&status)));
+}
+
+//! @brief Name in the cache of the plugin, or of the object of unit "u" if u >= 0.
+
+static BOOL_T plugin_cache_name (char *name, char *options, int u)
+{
+  BUFFER dn;
+  char *env = getenv ("A68G_CACHE");
+  if (env != NO_TEXT && strlen (env) > 0) {
+    ASSERT (a68_bufprt (dn, SNPRINTF_SIZE, "%s", env) >= 0);
+  } else if (getenv ("HOME") != NO_TEXT) {
+    ASSERT (a68_bufprt (dn, SNPRINTF_SIZE, "%s/%s", getenv ("HOME"), A68_DIR) >= 0);
+    if (!plugin_mkdir (dn)) {
+      return A68_FALSE;
+    }
+    a68_bufcat (dn, "/", BUFFER_SIZE);
+    a68_bufcat (dn, A68_CACHE_DIR, BUFFER_SIZE);
+  } else {
+    return A68_FALSE;
+  }
+  if (!plugin_mkdir (dn)) {
+    return A68_FALSE;
+  }
+// Two FNV-1a hashes with different offset bases make a 128-bit key.
+  uint64_t h[2] = {(uint64_t) 0xcbf29ce484222325ULL, (uint64_t) 0x84222325cbf29ce4ULL};
+  char *ext = (u < 0 ? PLUGIN_EXTENSION : BINARY_EXTENSION);
+  BUFFER key;
+  ASSERT (a68_bufprt (key, SNPRINTF_SIZE, "%s %s %s %s %s", PACKAGE_STRING, C_COMPILER, INCLUDE_DIR, options, ext) >= 0);
+  for (int k = 0; k < 2; k++) {
+    h[k] = plugin_hash (h[k], key, strlen (key) + 1);
+  }
+  if (u >= 0) {
+    if (!plugin_hash_object (h, 2, OBJECT (PLUGIN_UNIT (u)))) {
+      return A68_FALSE;
+    }
+  } else {
+    if (!plugin_hash_object (h, 2, FILE_OBJECT_NAME (&A68_JOB))) {
+      return A68_FALSE;
+    }
+    for (int k = 0; k < A68_OPT (units); k++) {
+      if (!plugin_hash_object (h, 2, OBJECT (PLUGIN_UNIT (k)))) {
+        return A68_FALSE;
+      }
+    }
+  }
+  ASSERT (a68_bufprt (name, SNPRINTF_SIZE, "%s/%016llx%016llx%s", dn, (unsigned long long) h[0], (unsigned long long) h[1], ext) >= 0);
+  return A68_TRUE;
+}
+
+//! @brief Copy file "src" to "dst".
+
+static BOOL_T plugin_copy (char *src, char *dst)
+{
+  FILE_T in = open (src, O_RDONLY);
+  if (in == -1) {
+    return A68_FALSE;
+  }
+  FILE_T out = open (dst, O_WRONLY | O_CREAT | O_TRUNC, S_IRUSR | S_IWUSR | S_IXUSR | S_IRGRP | S_IXGRP | S_IROTH | S_IXOTH);
+  if (out == -1) {
+    ASSERT (close (in) == 0);
+    return A68_FALSE;
+  }
+  BOOL_T ok = A68_TRUE;
+  BUFFER buf;
+  ssize_t n;
+  while (ok && (n = read (in, buf, BUFFER_SIZE)) > 0) {
+    ok = (BOOL_T) (write (out, buf, (size_t) n) == n);
+  }
+  ok = (BOOL_T) (ok && n == 0);
+  ASSERT (close (in) == 0);
+  ok = (BOOL_T) (close (out) == 0 && ok);
+  if (!ok) {
+    (void) remove (dst);
+  }
+  return ok;
+}
+
+//! @brief Store file "fn" under "name" in the cache.
+
+static void plugin_cache_store (char *fn, char *name)
+{
+// Copy, then rename, so concurrent jobs never load a partial file.
+  BUFFER tmp;
+  ASSERT (a68_bufprt (tmp, SNPRINTF_SIZE, "%s.%d", name, (int) getpid ()) >= 0);
+  if (plugin_copy (fn, tmp) && rename (tmp, name) != 0) {
+    (void) remove (tmp);
+  }
+}
+
+//! @brief Compile emitted code in "src" to object "bin".
+
+static void plugin_compile_object (char *src, char *bin, char *options)
+{
+  BUFFER cmd;
+  ASSERT (a68_bufprt (cmd, SNPRINTF_SIZE, "%s %s %s -c -o \"%s\" \"%s\"", C_COMPILER, INCLUDE_DIR, options, bin, src) >= 0);
+  ABEND (system (cmd) != 0, ERROR_ACTION, cmd);
+}
+
+//! @brief Object of unit "u", from the cache when it holds one.
+
+static void plugin_compile_unit (int u, char *options)
+{
+  PLUGIN_UNIT_T *z = PLUGIN_UNIT (u);
+  BUFFER cached;
+  BOOL_T cache = (BOOL_T) (OPTION_CACHE (&A68_JOB) && plugin_cache_name (cached, options, u));
+  if (cache && plugin_copy (cached, BINARY (z))) {
+    return;
+  }
+  plugin_compile_object (OBJECT (z), BINARY (z), options);
+  if (cache) {
+    plugin_cache_store (BINARY (z), cached);
+  }
+}
+
+//! @brief Remove emitted code of the program and its units.
+
+static void plugin_rm_objects (void)
+{
+  a68_rm (FILE_OBJECT_NAME (&A68_JOB));
+  for (int k = 0; k < A68_OPT (units); k++) {
+    a68_rm (OBJECT (PLUGIN_UNIT (k)));
+  }
+}
+
+#endif
+
 //! @brief Compile emitted code.
 
 void plugin_driver_compile (void)
@@ -61,8 +233,7 @@ void plugin_driver_compile (void)
 // TODO: One day this should be all portable between platforms.
 // Only compile if the A68 compiler found no errors (constant folder for instance).
   if (ERROR_COUNT (&A68_JOB) == 0 && OPTION_OPT_LEVEL (&A68_JOB) > 0 && !OPTION_RUN_SCRIPT (&A68_JOB)) {
-    BUFFER cmd, options;
-    BUFCLR (cmd);
+    BUFFER options;
     BUFCLR (options);
     if (OPTION_RERUN (&A68_JOB) == A68_FALSE) {
       announce_phase ("plugin compiler");
@@ -82,11 +253,34 @@ void plugin_driver_compile (void)
 //
 // Apple Silicon Mac patches kindly provided by Neil Matthew.
 
-      ASSERT (a68_bufprt (cmd, SNPRINTF_SIZE, "%s %s %s -c -o \"%s\" \"%s\"", C_COMPILER, INCLUDE_DIR, options, FILE_BINARY_NAME (&A68_JOB), FILE_OBJECT_NAME (&A68_JOB)) >= 0); 
-      ABEND (system (cmd) != 0, ERROR_ACTION, cmd);
-      ASSERT (a68_bufprt (cmd, SNPRINTF_SIZE, "ld %s -o \"%s\" \"%s\"", EXPORT_DYNAMIC_FLAGS, FILE_PLUGIN_NAME (&A68_JOB), FILE_BINARY_NAME (&A68_JOB)) >= 0);
-      ABEND (system (cmd) != 0, ERROR_ACTION, cmd);
+      BUFFER cached;
+      BOOL_T cache = (BOOL_T) (OPTION_CACHE (&A68_JOB) && plugin_cache_name (cached, options, -1));
+      if (cache && plugin_copy (cached, FILE_PLUGIN_NAME (&A68_JOB))) {
+        announce_phase ("plugin cache");
+        return;
+      }
+// Units from included files are compiled apart, and linked with the program.
+      plugin_compile_object (FILE_OBJECT_NAME (&A68_JOB), FILE_BINARY_NAME (&A68_JOB), options);
+      size_t len = BUFFER_SIZE;
+      for (int k = 0; k < A68_OPT (units); k++) {
+        plugin_compile_unit (k, options);
+        len += strlen (BINARY (PLUGIN_UNIT (k))) + 3;
+      }
+      char *ld = (char *) get_heap_space (len);
+      ASSERT (a68_bufprt (ld, len, "ld %s -o \"%s\" \"%s\"", EXPORT_DYNAMIC_FLAGS, FILE_PLUGIN_NAME (&A68_JOB), FILE_BINARY_NAME (&A68_JOB)) >= 0);
+      for (int k = 0; k < A68_OPT (units); k++) {
+        a68_bufcat (ld, " \"", len);
+        a68_bufcat (ld, BINARY (PLUGIN_UNIT (k)), len);
+        a68_bufcat (ld, "\"", len);
+      }
+      ABEND (system (ld) != 0, ERROR_ACTION, ld);
       a68_rm (FILE_BINARY_NAME (&A68_JOB));
+      for (int k = 0; k < A68_OPT (units); k++) {
+        a68_rm (BINARY (PLUGIN_UNIT (k)));
+      }
+      if (cache) {
+        plugin_cache_store (FILE_PLUGIN_NAME (&A68_JOB), cached);
+      }
     }
   }
 #endif
@@ -127,6 +321,14 @@ void plugin_driver_genie (void)
 // Then load compiler code.
     compile_plugin = dlopen (plugin_name, RTLD_NOW | RTLD_GLOBAL);
     ABEND (compile_plugin == NULL, ERROR_CANNOT_OPEN_PLUGIN, dlerror ());
+// Units from included files number nodes from their first node.
+    for (int k = 0; k < A68_OPT (units); k++) {
+      BUFFER name;
+      ASSERT (a68_bufprt (name, SNPRINTF_SIZE, "genie_%sbase", PREFIX (PLUGIN_UNIT (k))) >= 0);
+      int *base = (int *) dlsym (compile_plugin, name);
+      ABEND (base == NULL, ERROR_INTERNAL_CONSISTENCY, dlerror ());
+      *base = BASE (PLUGIN_UNIT (k));
+    }
   }
   genie (compile_plugin);
 // Unload compiler plugin.
@@ -145,13 +347,13 @@ void plugin_driver_clean (int emitted)
   announce_phase ("clean up intermediate files");
   if (OPTION_OPT_LEVEL (&A68_JOB) >= OPTIMISE_0 && OPTION_REGRESSION_TEST (&A68_JOB) && !OPTION_KEEP (&A68_JOB)) {
     if (emitted) {
-      a68_rm (FILE_OBJECT_NAME (&A68_JOB));
+      plugin_rm_objects ();
     }
     a68_rm (FILE_PLUGIN_NAME (&A68_JOB));
   }
   if (OPTION_RUN_SCRIPT (&A68_JOB) && !OPTION_KEEP (&A68_JOB)) {
     if (emitted) {
-      a68_rm (FILE_OBJECT_NAME (&A68_JOB));
+      plugin_rm_objects ();
     }
     a68_rm (FILE_SOURCE_NAME (&A68_JOB));
     a68_rm (FILE_PLUGIN_NAME (&A68_JOB));
@@ -159,22 +361,22 @@ void plugin_driver_clean (int emitted)
     build_script ();
     if (!OPTION_KEEP (&A68_JOB)) {
       if (emitted) {
-        a68_rm (FILE_OBJECT_NAME (&A68_JOB));
+        plugin_rm_objects ();
       }
       a68_rm (FILE_PLUGIN_NAME (&A68_JOB));
     }
   } else if (OPTION_OPT_LEVEL (&A68_JOB) == OPTIMISE_0 && !OPTION_KEEP (&A68_JOB)) {
     if (emitted) {
-      a68_rm (FILE_OBJECT_NAME (&A68_JOB));
+      plugin_rm_objects ();
     }
     a68_rm (FILE_PLUGIN_NAME (&A68_JOB));
   } else if (OPTION_OPT_LEVEL (&A68_JOB) > OPTIMISE_0 && !OPTION_KEEP (&A68_JOB)) {
     if (emitted) {
-      a68_rm (FILE_OBJECT_NAME (&A68_JOB));
+      plugin_rm_objects ();
     }
   } else if (OPTION_RERUN (&A68_JOB) && !OPTION_KEEP (&A68_JOB)) {
     if (emitted) {
-      a68_rm (FILE_OBJECT_NAME (&A68_JOB));
+      plugin_rm_objects ();
     }
   }
 #else
@@ -361,7 +361,7 @@ char *gen_uniting (NODE_T * p, FILE_T out, int compose_fun)
     inline_unit (q, out, L_DECLARE);
     print_declarations (out, A68_OPT (root_idf));
     indentf (out, a68_bufprt (A68 (edit_line), SNPRINTF_SIZE, "%s = A68_SP;\n", pop0));
-    indentf (out, a68_bufprt (A68 (edit_line), SNPRINTF_SIZE, "PUSH_UNION (_NODE_ (%d), %s);\n", NUMBER (p), internal_mode (v)));
+    indentf (out, a68_bufprt (A68 (edit_line), SNPRINTF_SIZE, "PUSH_UNION (_NODE_ (%d), %s);\n", unit_number (p), internal_mode (v)));
     inline_unit (q, out, L_EXECUTE);
     gen_push (q, out);
     indentf (out, a68_bufprt (A68 (edit_line), SNPRINTF_SIZE, "A68_SP = %s + %d;\n", pop0, SIZE (u)));
@@ -688,7 +688,7 @@ char *gen_voiding_assignation_slice (NODE_T * p, FILE_T out, int compose_fun)
   NODE_T *prim = SUB (slice);
   MOID_T *mode = SUB_MOID (dst);
   MOID_T *row_mode = DEFLEX (MOID (prim));
-  if (IS (row_mode, REF_SYMBOL) && basic_slice (slice) && basic_unit (src) && basic_mode_non_row (MOID (src))) {
+  if (IS (row_mode, REF_SYMBOL) && MOID (prim) != M_REF_STRING && basic_slice (slice) && basic_unit (src) && basic_mode_non_row (MOID (src))) {
     NODE_T *indx = NEXT (prim);
     char *symbol = NSYMBOL (SUB (prim));
     char drf[NAME_SIZE], idf[NAME_SIZE], arr[NAME_SIZE], tup[NAME_SIZE], elm[NAME_SIZE], pop[NAME_SIZE];
@@ -877,14 +877,14 @@ void gen_declaration_list (NODE_T * p, FILE_T out, int *decs, char *pop)
         return;
       }
     case OPERATOR_DECLARATION: {
-        indentf (out, a68_bufprt (A68 (edit_line), SNPRINTF_SIZE, "genie_operator_dec (_NODE_ (%d));", NUMBER (SUB (p))));
+        indentf (out, a68_bufprt (A68 (edit_line), SNPRINTF_SIZE, "genie_operator_dec (_NODE_ (%d));", unit_number (SUB (p))));
         inline_comment_source (p, out);
         undent (out, NEWLINE_STRING);
         (*decs)++;
         break;
       }
     case IDENTITY_DECLARATION: {
-        indentf (out, a68_bufprt (A68 (edit_line), SNPRINTF_SIZE, "genie_identity_dec (_NODE_ (%d));", NUMBER (SUB (p))));
+        indentf (out, a68_bufprt (A68 (edit_line), SNPRINTF_SIZE, "genie_identity_dec (_NODE_ (%d));", unit_number (SUB (p))));
         inline_comment_source (p, out);
         undent (out, NEWLINE_STRING);
         (*decs)++;
@@ -898,7 +898,7 @@ void gen_declaration_list (NODE_T * p, FILE_T out, int *decs, char *pop)
         undent (out, NEWLINE_STRING);
         A68_OPT (indentation)++;
         indentf (out, a68_bufprt (A68 (edit_line), SNPRINTF_SIZE, "NODE_T *%s = NO_NODE;\n", declarer));
-        indentf (out, a68_bufprt (A68 (edit_line), SNPRINTF_SIZE, "genie_variable_dec (_NODE_ (%d), &%s, A68_SP);\n", NUMBER (SUB (p)), declarer));
+        indentf (out, a68_bufprt (A68 (edit_line), SNPRINTF_SIZE, "genie_variable_dec (_NODE_ (%d), &%s, A68_SP);\n", unit_number (SUB (p)), declarer));
         indentf (out, a68_bufprt (A68 (edit_line), SNPRINTF_SIZE, "A68_SP = %s;\n", pop));
         A68_OPT (indentation)--;
         indent (out, "}\n");
@@ -906,7 +906,7 @@ void gen_declaration_list (NODE_T * p, FILE_T out, int *decs, char *pop)
         break;
       }
     case PROCEDURE_VARIABLE_DECLARATION: {
-        indentf (out, a68_bufprt (A68 (edit_line), SNPRINTF_SIZE, "genie_proc_variable_dec (_NODE_ (%d));", NUMBER (SUB (p))));
+        indentf (out, a68_bufprt (A68 (edit_line), SNPRINTF_SIZE, "genie_proc_variable_dec (_NODE_ (%d));", unit_number (SUB (p))));
         inline_comment_source (p, out);
         undent (out, NEWLINE_STRING);
         indentf (out, a68_bufprt (A68 (edit_line), SNPRINTF_SIZE, "A68_SP = %s;\n", pop));
@@ -988,7 +988,7 @@ void embed_serial_clause (NODE_T * p, FILE_T out, char *pop)
 {
   NODE_T *last = NO_NODE;
   int units = 0, decs = 0;
-  indentf (out, a68_bufprt (A68 (edit_line), SNPRINTF_SIZE, "OPEN_STATIC_FRAME (_NODE_ (%d));\n", NUMBER (p)));
+  indentf (out, a68_bufprt (A68 (edit_line), SNPRINTF_SIZE, "OPEN_STATIC_FRAME (_NODE_ (%d));\n", unit_number (p)));
   init_static_frame (out, p);
   gen_serial_clause (p, out, &last, &units, &decs, pop, A68_MAKE_FUNCTION);
   indent (out, "CLOSE_FRAME;\n");
@@ -1259,7 +1259,7 @@ BOOL_T gen_int_case_units (NODE_T * p, FILE_T out, NODE_T * sym, int k, int *cou
         if (compose_fun == A68_MAKE_FUNCTION) {
           indentf (out, a68_bufprt (A68 (edit_line), SNPRINTF_SIZE, "case %d: {\n", k));
           A68_OPT (indentation)++;
-          indentf (out, a68_bufprt (A68 (edit_line), SNPRINTF_SIZE, "OPEN_STATIC_FRAME (_NODE_ (%d));\n", NUMBER (sym)));
+          indentf (out, a68_bufprt (A68 (edit_line), SNPRINTF_SIZE, "OPEN_STATIC_FRAME (_NODE_ (%d));\n", unit_number (sym)));
           CODE_EXECUTE (p);
           inline_comment_source (p, out);
           undent (out, NEWLINE_STRING);
@@ -1505,10 +1505,10 @@ char *gen_loop_clause (NODE_T * p, FILE_T out, int compose_fun)
   if (while_part != NO_NODE) {
     inline_unit (SUB (NEXT_SUB (while_part)), out, L_EXECUTE);
   }
-  indentf (out, a68_bufprt (A68 (edit_line), SNPRINTF_SIZE, "OPEN_STATIC_FRAME (_NODE_ (%d));\n", NUMBER (sc)));
+  indentf (out, a68_bufprt (A68 (edit_line), SNPRINTF_SIZE, "OPEN_STATIC_FRAME (_NODE_ (%d));\n", unit_number (sc)));
   init_static_frame (out, sc);
   if (for_part != NO_NODE) {
-    indentf (out, a68_bufprt (A68 (edit_line), SNPRINTF_SIZE, "%s = (A68_INT *) (FRAME_OBJECT (OFFSET (TAX (_NODE_ (%d)))));\n", z, NUMBER (for_part)));
+    indentf (out, a68_bufprt (A68 (edit_line), SNPRINTF_SIZE, "%s = (A68_INT *) (FRAME_OBJECT (OFFSET (TAX (_NODE_ (%d)))));\n", z, unit_number (for_part)));
   }
 // The loop in C.
 // Initialisation.
@@ -1589,7 +1589,7 @@ char *gen_loop_clause (NODE_T * p, FILE_T out, int compose_fun)
 #endif
     }
     if (need_initialise_frame (sc)) {
-      indentf (out, a68_bufprt (A68 (edit_line), SNPRINTF_SIZE, "initialise_frame (_NODE_ (%d));\n", NUMBER (sc)));
+      indentf (out, a68_bufprt (A68 (edit_line), SNPRINTF_SIZE, "initialise_frame (_NODE_ (%d));\n", unit_number (sc)));
     }
     A68_OPT (indentation)--;
     indent (out, "}\n");
@@ -1775,12 +1775,17 @@ void gen_units (NODE_T * p, FILE_T out)
 {
   for (; p != NO_NODE; FORWARD (p)) {
     if (IS (p, UNIT) || IS (p, CODE_CLAUSE)) {
-      if (gen_unit (p, out, A68_MAKE_FUNCTION) == NO_TEXT) {
+// Units nested in a function may go to another unit; resume the enclosing one after.
+      char *prefix = A68_OPT (unit_prefix);
+      int base = A68_OPT (unit_base);
+      if (gen_unit (p, unit_out (p, out), A68_MAKE_FUNCTION) == NO_TEXT) {
         gen_units (SUB (p), out);
       } else if (SUB (p) != NO_NODE && GINFO (SUB (p)) != NO_GINFO && COMPILE_NODE (GINFO (SUB (p))) > 0) {
         COMPILE_NODE (GINFO (p)) = COMPILE_NODE (GINFO (SUB (p)));
         COMPILE_NAME (GINFO (p)) = new_string (COMPILE_NAME (GINFO (SUB (p))), NO_TEXT);
       }
+      A68_OPT (unit_prefix) = prefix;
+      A68_OPT (unit_base) = base;
     } else {
       gen_units (SUB (p), out);
     }
@@ -1793,12 +1798,17 @@ void gen_basics (NODE_T * p, FILE_T out)
 {
   for (; p != NO_NODE; FORWARD (p)) {
     if (IS (p, UNIT) || IS (p, CODE_CLAUSE)) {
-      if (gen_basic (p, out) == NO_TEXT) {
+// Units nested in a function may go to another unit; resume the enclosing one after.
+      char *prefix = A68_OPT (unit_prefix);
+      int base = A68_OPT (unit_base);
+      if (gen_basic (p, unit_out (p, out)) == NO_TEXT) {
         gen_basics (SUB (p), out);
       } else if (SUB (p) != NO_NODE && GINFO (SUB (p)) != NO_GINFO && COMPILE_NODE (GINFO (SUB (p))) > 0) {
         COMPILE_NODE (GINFO (p)) = COMPILE_NODE (GINFO (SUB (p)));
         COMPILE_NAME (GINFO (p)) = new_string (COMPILE_NAME (GINFO (SUB (p))), NO_TEXT);
       }
+      A68_OPT (unit_prefix) = prefix;
+      A68_OPT (unit_base) = base;
     } else {
       gen_basics (SUB (p), out);
     }
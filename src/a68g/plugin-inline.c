@@ -64,7 +64,7 @@ void inline_arguments (NODE_T * p, FILE_T out, int phase, int *size)
   if (p == NO_NODE) {
     return;
   } else if (IS (p, UNIT) && phase == L_PUSH) {
-    indentf (out, a68_bufprt (A68 (edit_line), SNPRINTF_SIZE, "GENIE_UNIT_TRACE (_NODE_ (%d));\n", NUMBER (p)));
+    indentf (out, a68_bufprt (A68 (edit_line), SNPRINTF_SIZE, "GENIE_UNIT_TRACE (_NODE_ (%d));\n", unit_number (p)));
     inline_arguments (NEXT (p), out, L_PUSH, size);
   } else if (IS (p, UNIT)) {
     char arg[NAME_SIZE];
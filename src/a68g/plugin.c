@@ -103,6 +103,9 @@ void plugin_driver_emit (FILE_T out)
   A68_OPT (procedures) = 0;
   A68_OPT (cse_pointer) = 0;
   A68_OPT (unic_pointer) = 0;
+  A68_OPT (units) = 0;
+  A68_OPT (unit_prefix) = "";
+  A68_OPT (unit_base) = 0;
   A68_OPT (root_idf) = NO_DEC;
   A68 (global_level) = INT_MAX;
   A68_GLOBALS = 0;
@@ -133,10 +136,13 @@ void plugin_driver_emit (FILE_T out)
     gen_units (TOP_NODE (&A68_JOB), out);
   }
   ABEND (A68_OPT (indentation) != 0, ERROR_INTERNAL_CONSISTENCY, __func__);
+  for (int k = 0; k < A68_OPT (units); k++) {
+    ASSERT (close (FD (PLUGIN_UNIT (k))) == 0);
+  }
 // At the end we discard temporary declarations.
   A68 (temp_heap_pointer) = pop_temp_heap_pointer;
   if (OPTION_VERBOSE (&A68_JOB)) {
-    ASSERT (a68_bufprt (A68 (output_line), SNPRINTF_SIZE, "%s: A68_OPT (procedures)=%d unique-names=%d", A68 (a68_cmd_name), A68_OPT (procedures), A68_OPT (unic_pointer)) >= 0);
+    ASSERT (a68_bufprt (A68 (output_line), SNPRINTF_SIZE, "%s: A68_OPT (procedures)=%d unique-names=%d units=%d", A68 (a68_cmd_name), A68_OPT (procedures), A68_OPT (unic_pointer), A68_OPT (units) + 1) >= 0);
     io_close_tty_line ();
     WRITE (A68_STDOUT, A68 (output_line));
   }
@@ -326,9 +332,9 @@ void print_declarations (FILE_T out, DEC_T * p)
 char *make_unic_name (char *buf, char *name, char *tag, char *ext)
 {
   if (strlen (tag) > 0) {
-    ASSERT (a68_bufprt (buf, NAME_SIZE, "genie_%s_%s_%s", name, tag, ext) >= 0);
+    ASSERT (a68_bufprt (buf, NAME_SIZE, "genie_%s%s_%s_%s", A68_OPT (unit_prefix), name, tag, ext) >= 0);
   } else {
-    ASSERT (a68_bufprt (buf, NAME_SIZE, "genie_%s_%s", name, ext) >= 0);
+    ASSERT (a68_bufprt (buf, NAME_SIZE, "genie_%s%s_%s", A68_OPT (unit_prefix), name, ext) >= 0);
   }
   ABEND (strlen (buf) >= NAME_SIZE, ERROR_ACTION, __func__);
   return buf;
@@ -392,9 +398,9 @@ BOOK_T *signed_in (int action, int phase, const char *idf)
 char *make_name (char *buf, char *name, char *tag, int n)
 {
   if (strlen (tag) > 0) {
-    ASSERT (a68_bufprt (buf, NAME_SIZE, "genie_%s_%s_%d", name, tag, n) >= 0);
+    ASSERT (a68_bufprt (buf, NAME_SIZE, "genie_%s%s_%s_%d", A68_OPT (unit_prefix), name, tag, n - A68_OPT (unit_base)) >= 0);
   } else {
-    ASSERT (a68_bufprt (buf, NAME_SIZE, "genie_%s_%d", name, n) >= 0);
+    ASSERT (a68_bufprt (buf, NAME_SIZE, "genie_%s%s_%d", A68_OPT (unit_prefix), name, n - A68_OPT (unit_base)) >= 0);
   }
   ABEND (strlen (buf) >= NAME_SIZE, ERROR_ACTION, __func__);
   return buf;
@@ -573,6 +579,98 @@ void write_prelude (FILE_T out)
   indent (out, "#define _VALUE_(z) (VALUE (z))\n");
 }
 
+// Code from an included file goes to a unit of its own, so the C compiler
+// translates it apart from the program, and its object can be cached and
+// reused by every program that includes the file unchanged. Names in a unit
+// start with a prefix hashed from the file name, and node numbers in a unit
+// count from its first node, with the base set when the plugin is loaded.
+// So code of the included file does not depend on the rest of the program.
+
+//! @brief FNV-1a hash of "len" bytes at "s", continuing from "h".
+
+uint64_t plugin_hash (uint64_t h, const char *s, size_t len)
+{
+  for (size_t k = 0; k < len; k++) {
+    h ^= (uint64_t) (unsigned char) s[k];
+    h *= (uint64_t) 0x100000001b3ULL;
+  }
+  return h;
+}
+
+//! @brief Number of node "p" in emitted code of the current unit.
+
+int unit_number (NODE_T * p)
+{
+  return NUMBER (p) - A68_OPT (unit_base);
+}
+
+//! @brief Emit code of following nodes into unit "u", or into the program if u < 0.
+
+static FILE_T unit_select (int u, FILE_T out)
+{
+  if (u < 0) {
+    A68_OPT (unit_prefix) = "";
+    A68_OPT (unit_base) = 0;
+    return out;
+  } else {
+    A68_OPT (unit_prefix) = PREFIX (PLUGIN_UNIT (u));
+    A68_OPT (unit_base) = BASE (PLUGIN_UNIT (u));
+    return FD (PLUGIN_UNIT (u));
+  }
+}
+
+//! @brief Output for the code of unit "p"; "out" unless "p" is from an included file.
+
+FILE_T unit_out (NODE_T * p, FILE_T out)
+{
+  LINE_T *l = LINE (INFO (p));
+// Prelude and postlude lines have number zero.
+  if (l == NO_LINE || NUMBER (l) == 0 || FILENAME (l) == NO_TEXT || strcmp (FILENAME (l), FILE_SOURCE_NAME (&A68_JOB)) == 0) {
+    return unit_select (-1, out);
+  }
+  for (int k = 0; k < A68_OPT (units); k++) {
+    if (strcmp (SOURCE (PLUGIN_UNIT (k)), FILENAME (l)) == 0) {
+      return unit_select (k, out);
+    }
+  }
+  if (A68_OPT (units) == MAX_PLUGIN_UNITS) {
+    return unit_select (-1, out);
+  }
+  BUFFER prefix;
+  uint64_t h = plugin_hash ((uint64_t) 0xcbf29ce484222325ULL, FILENAME (l), strlen (FILENAME (l)));
+  ASSERT (a68_bufprt (prefix, SNPRINTF_SIZE, "u%08x_", (unt) (h & 0xffffffff)) >= 0);
+// Two files whose names hash alike share the program's code.
+  for (int k = 0; k < A68_OPT (units); k++) {
+    if (strcmp (PREFIX (PLUGIN_UNIT (k)), prefix) == 0) {
+      return unit_select (-1, out);
+    }
+  }
+  PLUGIN_UNIT_T *u = PLUGIN_UNIT (A68_OPT (units));
+  BUFFER name;
+  ASSERT (a68_bufprt (name, SNPRINTF_SIZE, "%s.%d%s", FILE_GENERIC_NAME (&A68_JOB), A68_OPT (units) + 1, OBJECT_EXTENSION) >= 0);
+  FILE_T fd = open (name, O_WRONLY | O_CREAT | O_TRUNC, A68_PROTECTION);
+  if (fd == -1) {
+    return unit_select (-1, out);
+  }
+  SOURCE (u) = new_string (FILENAME (l), NO_TEXT);
+  OBJECT (u) = new_string (name, NO_TEXT);
+  ASSERT (a68_bufprt (name, SNPRINTF_SIZE, "%s.%d%s", FILE_GENERIC_NAME (&A68_JOB), A68_OPT (units) + 1, BINARY_EXTENSION) >= 0);
+  BINARY (u) = new_string (name, NO_TEXT);
+  PREFIX (u) = new_string (prefix, NO_TEXT);
+  BASE (u) = NUMBER (p);
+  FD (u) = fd;
+  A68_OPT (units)++;
+  int indentation = A68_OPT (indentation);
+  A68_OPT (indentation) = 0;
+  indentf (fd, a68_bufprt (A68 (edit_line), SNPRINTF_SIZE, "// \"%s\"\n", SOURCE (u)));
+  write_prelude (fd);
+  indentf (fd, a68_bufprt (A68 (edit_line), SNPRINTF_SIZE, "\nint genie_%sbase = 0;\n", prefix));
+  indent (fd, "#undef _NODE_\n");
+  indentf (fd, a68_bufprt (A68 (edit_line), SNPRINTF_SIZE, "#define _NODE_(n) (A68 (node_register)[genie_%sbase + (n)])\n", prefix));
+  A68_OPT (indentation) = indentation;
+  return unit_select (A68_OPT (units) - 1, out);
+}
+
 //! @brief Write initialisation of frame.
 
 void init_static_frame (FILE_T out, NODE_T * p)
@@ -584,7 +682,7 @@ void init_static_frame (FILE_T out, NODE_T * p)
     indent (out, "A68_GLOBALS = A68_FP;\n");
   }
   if (need_initialise_frame (p)) {
-    indentf (out, a68_bufprt (A68 (edit_line), SNPRINTF_SIZE, "initialise_frame (_NODE_ (%d));\n", NUMBER (p)));
+    indentf (out, a68_bufprt (A68 (edit_line), SNPRINTF_SIZE, "initialise_frame (_NODE_ (%d));\n", unit_number (p)));
   }
 }
 
@@ -645,7 +743,7 @@ void write_fun_prelude (NODE_T * p, FILE_T out, char *fn)
   A68_OPT (indentation)++;
   indent (out, "PROP_T self;\n");
   indentf (out, a68_bufprt (A68 (edit_line), SNPRINTF_SIZE, "UNIT (&self) = %s;\n", fn));
-  indentf (out, a68_bufprt (A68 (edit_line), SNPRINTF_SIZE, "SOURCE (&self) = _NODE_ (%d);\n", NUMBER (p)));
+  indentf (out, a68_bufprt (A68 (edit_line), SNPRINTF_SIZE, "SOURCE (&self) = _NODE_ (%d);\n", unit_number (p)));
   A68_OPT (cse_pointer) = 0;
 }
 
@@ -215,15 +215,10 @@ void stand_gsl_linear_algebra (void)
   m = a68_proc (M_VOID, M_ROW_ROW_REAL, M_INT, NO_MOID);
   a68_idf (A68_EXT, "printmatrix", m, genie_print_matrix);
 // Vector and matrix monadic.
-  m = a68_proc (M_ROW_REAL, M_ROW_REAL, NO_MOID);
-  a68_op (A68_EXT, "+", m, genie_idle);
-  a68_op (A68_EXT, "-", m, genie_vector_minus);
   m = a68_proc (M_ROW_ROW_REAL, M_ROW_REAL, NO_MOID);
   a68_op (A68_EXT, "CV", m, genie_vector_col);
   a68_op (A68_EXT, "RV", m, genie_vector_row);
   m = a68_proc (M_ROW_ROW_REAL, M_ROW_ROW_REAL, NO_MOID);
-  a68_op (A68_EXT, "+", m, genie_idle);
-  a68_op (A68_EXT, "-", m, genie_matrix_minus);
   a68_op (A68_EXT, "T", m, genie_matrix_transpose);
   a68_op (A68_EXT, "INV", m, genie_matrix_inv);
   a68_op (A68_EXT, "PINV", m, genie_matrix_pinv);
@@ -243,32 +238,11 @@ void stand_gsl_linear_algebra (void)
   a68_op (A68_EXT, "DET", m, genie_matrix_complex_det);
   a68_op (A68_EXT, "TRACE", m, genie_matrix_complex_trace);
 // Vector and matrix dyadic.
-  m = a68_proc (M_BOOL, M_ROW_REAL, M_ROW_REAL, NO_MOID);
-  a68_op (A68_EXT, "=", m, genie_vector_eq);
-  a68_op (A68_EXT, "/=", m, genie_vector_ne);
-  m = a68_proc (M_ROW_REAL, M_ROW_REAL, M_ROW_REAL, NO_MOID);
-  a68_op (A68_EXT, "+", m, genie_vector_add);
-  a68_op (A68_EXT, "-", m, genie_vector_sub);
-  m = a68_proc (M_REF_ROW_REAL, M_REF_ROW_REAL, M_ROW_REAL, NO_MOID);
-  a68_op (A68_EXT, "+:=", m, genie_vector_plusab);
-  a68_op (A68_EXT, "PLUSAB", m, genie_vector_plusab);
-  a68_op (A68_EXT, "-:=", m, genie_vector_minusab);
-  a68_op (A68_EXT, "MINUSAB", m, genie_vector_minusab);
-  m = a68_proc (M_BOOL, M_ROW_ROW_REAL, M_ROW_ROW_REAL, NO_MOID);
-  a68_op (A68_EXT, "=", m, genie_matrix_eq);
-  a68_op (A68_EXT, "/-", m, genie_matrix_ne);
   m = a68_proc (M_ROW_ROW_REAL, M_ROW_ROW_REAL, M_ROW_ROW_REAL, NO_MOID);
-  a68_op (A68_EXT, "+", m, genie_matrix_add);
-  a68_op (A68_EXT, "-", m, genie_matrix_sub);
   a68_op (A68_EXT, "BEFORE", m, genie_matrix_hcat);
   a68_op (A68_EXT, "ABOVE", m, genie_matrix_vcat);
   a68_prio ("BEFORE", 3);
   a68_prio ("ABOVE", 3);
-  m = a68_proc (M_REF_ROW_ROW_REAL, M_REF_ROW_ROW_REAL, M_ROW_ROW_REAL, NO_MOID);
-  a68_op (A68_EXT, "+:=", m, genie_matrix_plusab);
-  a68_op (A68_EXT, "PLUSAB", m, genie_matrix_plusab);
-  a68_op (A68_EXT, "-:=", m, genie_matrix_minusab);
-  a68_op (A68_EXT, "MINUSAB", m, genie_matrix_minusab);
   m = a68_proc (M_BOOL, M_ROW_COMPLEX, M_ROW_COMPLEX, NO_MOID);
   a68_op (A68_EXT, "=", m, genie_vector_complex_eq);
   a68_op (A68_EXT, "/=", m, genie_vector_complex_ne);
@@ -292,16 +266,6 @@ void stand_gsl_linear_algebra (void)
   a68_op (A68_EXT, "-:=", m, genie_matrix_complex_minusab);
   a68_op (A68_EXT, "MINUSAB", m, genie_matrix_complex_minusab);
 // Vector and matrix scaling.
-  m = a68_proc (M_ROW_REAL, M_REAL, M_ROW_REAL, NO_MOID);
-  a68_op (A68_EXT, "*", m, genie_real_scale_vector);
-  m = a68_proc (M_ROW_REAL, M_ROW_REAL, M_REAL, NO_MOID);
-  a68_op (A68_EXT, "*", m, genie_vector_scale_real);
-  a68_op (A68_EXT, "/", m, genie_vector_div_real);
-  m = a68_proc (M_ROW_ROW_REAL, M_REAL, M_ROW_ROW_REAL, NO_MOID);
-  a68_op (A68_EXT, "*", m, genie_real_scale_matrix);
-  m = a68_proc (M_ROW_ROW_REAL, M_ROW_ROW_REAL, M_REAL, NO_MOID);
-  a68_op (A68_EXT, "*", m, genie_matrix_scale_real);
-  a68_op (A68_EXT, "/", m, genie_matrix_div_real);
   m = a68_proc (M_ROW_COMPLEX, M_COMPLEX, M_ROW_COMPLEX, NO_MOID);
   a68_op (A68_EXT, "*", m, genie_complex_scale_vector_complex);
   m = a68_proc (M_ROW_COMPLEX, M_ROW_COMPLEX, M_COMPLEX, NO_MOID);
@@ -312,12 +276,6 @@ void stand_gsl_linear_algebra (void)
   m = a68_proc (M_ROW_ROW_COMPLEX, M_ROW_ROW_COMPLEX, M_COMPLEX, NO_MOID);
   a68_op (A68_EXT, "*", m, genie_matrix_complex_scale_complex);
   a68_op (A68_EXT, "/", m, genie_matrix_complex_div_complex);
-  m = a68_proc (M_REF_ROW_REAL, M_REF_ROW_REAL, M_REAL, NO_MOID);
-  a68_op (A68_EXT, "*:=", m, genie_vector_scale_real_ab);
-  a68_op (A68_EXT, "/:=", m, genie_vector_div_real_ab);
-  m = a68_proc (M_REF_ROW_ROW_REAL, M_REF_ROW_ROW_REAL, M_REAL, NO_MOID);
-  a68_op (A68_EXT, "*:=", m, genie_matrix_scale_real_ab);
-  a68_op (A68_EXT, "/:=", m, genie_matrix_div_real_ab);
   m = a68_proc (M_REF_ROW_COMPLEX, M_REF_ROW_COMPLEX, M_COMPLEX, NO_MOID);
   a68_op (A68_EXT, "*:=", m, genie_vector_complex_scale_complex_ab);
   a68_op (A68_EXT, "/:=", m, genie_vector_complex_div_complex_ab);
@@ -328,15 +286,11 @@ void stand_gsl_linear_algebra (void)
   a68_op (A68_EXT, "*", m, genie_vector_times_matrix);
   m = a68_proc (M_ROW_COMPLEX, M_ROW_COMPLEX, M_ROW_ROW_COMPLEX, NO_MOID);
   a68_op (A68_EXT, "*", m, genie_vector_complex_times_matrix);
-// Matrix times vector or matrix.
+// Matrix times vector.
   m = a68_proc (M_ROW_REAL, M_ROW_ROW_REAL, M_ROW_REAL, NO_MOID);
   a68_op (A68_EXT, "*", m, genie_matrix_times_vector);
-  m = a68_proc (M_ROW_ROW_REAL, M_ROW_ROW_REAL, M_ROW_ROW_REAL, NO_MOID);
-  a68_op (A68_EXT, "*", m, genie_matrix_times_matrix);
   m = a68_proc (M_ROW_COMPLEX, M_ROW_ROW_COMPLEX, M_ROW_COMPLEX, NO_MOID);
   a68_op (A68_EXT, "*", m, genie_matrix_complex_times_vector);
-  m = a68_proc (M_ROW_ROW_COMPLEX, M_ROW_ROW_COMPLEX, M_ROW_ROW_COMPLEX, NO_MOID);
-  a68_op (A68_EXT, "*", m, genie_matrix_complex_times_matrix);
 // Vector and matrix miscellaneous.
   m = a68_proc (M_ROW_REAL, M_ROW_REAL, NO_MOID);
   a68_idf (A68_EXT, "vectorecho", m, genie_vector_echo);
@@ -346,8 +300,6 @@ void stand_gsl_linear_algebra (void)
   a68_idf (A68_EXT, "complvectorecho", m, genie_vector_complex_echo);
   m = a68_proc (M_ROW_ROW_COMPLEX, M_ROW_ROW_COMPLEX, NO_MOID);
   a68_idf (A68_EXT, "complmatrixecho", m, genie_matrix_complex_echo);
-  m = a68_proc (M_REAL, M_ROW_REAL, M_ROW_REAL, NO_MOID);
-  a68_op (A68_EXT, "*", m, genie_vector_dot);
   m = a68_proc (M_COMPLEX, M_ROW_COMPLEX, M_ROW_COMPLEX, NO_MOID);
   a68_op (A68_EXT, "*", m, genie_vector_complex_dot);
   m = a68_proc (M_REAL, M_ROW_REAL, NO_MOID);
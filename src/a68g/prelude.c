@@ -2056,6 +2056,8 @@ void stand_extensions (void)
   a68_idf (A68_EXT, "grepinsubstring", m, genie_grep_in_substring);
   m = a68_proc (M_INT, M_STRING, M_STRING, M_REF_STRING, NO_MOID);
   a68_idf (A68_EXT, "subinstring", m, genie_sub_in_string);
+  a68_idf (A68_EXT, "regexcachehits", A68_MCACHE (proc_int), genie_regex_cache_hits);
+  a68_idf (A68_EXT, "regexcachemisses", A68_MCACHE (proc_int), genie_regex_cache_misses);
 #if defined (HAVE_DIRENT_H)
   m = a68_proc (M_ROW_STRING, M_STRING, NO_MOID);
   a68_idf (A68_EXT, "getdirectory", m, genie_directory);
@@ -2067,6 +2069,81 @@ void stand_extensions (void)
 #endif
 }
 
+//! @brief Set up standenv - elementwise vector and matrix operators.
+
+void stand_torrix (void)
+{
+// [] REAL and [, ] REAL monadic.
+  MOID_T *m = a68_proc (M_ROW_REAL, M_ROW_REAL, NO_MOID);
+  a68_op (A68_EXT, "+", m, genie_idle);
+  a68_op (A68_EXT, "-", m, genie_vector_minus);
+  m = a68_proc (M_ROW_ROW_REAL, M_ROW_ROW_REAL, NO_MOID);
+  a68_op (A68_EXT, "+", m, genie_idle);
+  a68_op (A68_EXT, "-", m, genie_matrix_minus);
+// [] REAL and [, ] REAL dyadic.
+  m = a68_proc (M_BOOL, M_ROW_REAL, M_ROW_REAL, NO_MOID);
+  a68_op (A68_EXT, "=", m, genie_vector_eq);
+  a68_op (A68_EXT, "/=", m, genie_vector_ne);
+  m = a68_proc (M_ROW_REAL, M_ROW_REAL, M_ROW_REAL, NO_MOID);
+  a68_op (A68_EXT, "+", m, genie_vector_add);
+  a68_op (A68_EXT, "-", m, genie_vector_sub);
+  m = a68_proc (M_REF_ROW_REAL, M_REF_ROW_REAL, M_ROW_REAL, NO_MOID);
+  a68_op (A68_EXT, "+:=", m, genie_vector_plusab);
+  a68_op (A68_EXT, "PLUSAB", m, genie_vector_plusab);
+  a68_op (A68_EXT, "-:=", m, genie_vector_minusab);
+  a68_op (A68_EXT, "MINUSAB", m, genie_vector_minusab);
+  m = a68_proc (M_REAL, M_ROW_REAL, M_ROW_REAL, NO_MOID);
+  a68_op (A68_EXT, "*", m, genie_vector_dot);
+  m = a68_proc (M_BOOL, M_ROW_ROW_REAL, M_ROW_ROW_REAL, NO_MOID);
+  a68_op (A68_EXT, "=", m, genie_matrix_eq);
+  a68_op (A68_EXT, "/=", m, genie_matrix_ne);
+  m = a68_proc (M_ROW_ROW_REAL, M_ROW_ROW_REAL, M_ROW_ROW_REAL, NO_MOID);
+  a68_op (A68_EXT, "+", m, genie_matrix_add);
+  a68_op (A68_EXT, "-", m, genie_matrix_sub);
+  m = a68_proc (M_REF_ROW_ROW_REAL, M_REF_ROW_ROW_REAL, M_ROW_ROW_REAL, NO_MOID);
+  a68_op (A68_EXT, "+:=", m, genie_matrix_plusab);
+  a68_op (A68_EXT, "PLUSAB", m, genie_matrix_plusab);
+  a68_op (A68_EXT, "-:=", m, genie_matrix_minusab);
+  a68_op (A68_EXT, "MINUSAB", m, genie_matrix_minusab);
+// [] REAL and [, ] REAL scaling.
+  m = a68_proc (M_ROW_REAL, M_REAL, M_ROW_REAL, NO_MOID);
+  a68_op (A68_EXT, "*", m, genie_real_scale_vector);
+  m = a68_proc (M_ROW_REAL, M_ROW_REAL, M_REAL, NO_MOID);
+  a68_op (A68_EXT, "*", m, genie_vector_scale_real);
+  a68_op (A68_EXT, "/", m, genie_vector_div_real);
+  m = a68_proc (M_ROW_ROW_REAL, M_REAL, M_ROW_ROW_REAL, NO_MOID);
+  a68_op (A68_EXT, "*", m, genie_real_scale_matrix);
+  m = a68_proc (M_ROW_ROW_REAL, M_ROW_ROW_REAL, M_REAL, NO_MOID);
+  a68_op (A68_EXT, "*", m, genie_matrix_scale_real);
+  a68_op (A68_EXT, "/", m, genie_matrix_div_real);
+  m = a68_proc (M_REF_ROW_REAL, M_REF_ROW_REAL, M_REAL, NO_MOID);
+  a68_op (A68_EXT, "*:=", m, genie_vector_scale_real_ab);
+  a68_op (A68_EXT, "/:=", m, genie_vector_div_real_ab);
+  m = a68_proc (M_REF_ROW_ROW_REAL, M_REF_ROW_ROW_REAL, M_REAL, NO_MOID);
+  a68_op (A68_EXT, "*:=", m, genie_matrix_scale_real_ab);
+  a68_op (A68_EXT, "/:=", m, genie_matrix_div_real_ab);
+// Matrix products.
+  m = a68_proc (M_ROW_ROW_REAL, M_ROW_ROW_REAL, M_ROW_ROW_REAL, NO_MOID);
+  a68_op (A68_EXT, "*", m, genie_matrix_times_matrix);
+  m = a68_proc (M_ROW_ROW_COMPLEX, M_ROW_ROW_COMPLEX, M_ROW_ROW_COMPLEX, NO_MOID);
+  a68_op (A68_EXT, "*", m, genie_matrix_complex_times_matrix);
+// [] INT.
+  m = a68_proc (M_ROW_INT, M_ROW_INT, NO_MOID);
+  a68_op (A68_EXT, "+", m, genie_idle);
+  a68_op (A68_EXT, "-", m, genie_vector_minus_int);
+  m = a68_proc (M_BOOL, M_ROW_INT, M_ROW_INT, NO_MOID);
+  a68_op (A68_EXT, "=", m, genie_vector_eq_int);
+  a68_op (A68_EXT, "/=", m, genie_vector_ne_int);
+  m = a68_proc (M_ROW_INT, M_ROW_INT, M_ROW_INT, NO_MOID);
+  a68_op (A68_EXT, "+", m, genie_vector_add_int);
+  a68_op (A68_EXT, "-", m, genie_vector_sub_int);
+  m = a68_proc (M_REF_ROW_INT, M_REF_ROW_INT, M_ROW_INT, NO_MOID);
+  a68_op (A68_EXT, "+:=", m, genie_vector_plusab_int);
+  a68_op (A68_EXT, "PLUSAB", m, genie_vector_plusab_int);
+  a68_op (A68_EXT, "-:=", m, genie_vector_minusab_int);
+  a68_op (A68_EXT, "MINUSAB", m, genie_vector_minusab_int);
+}
+
 #if defined (HAVE_GNU_PLOTUTILS)
 
 void stand_plot (void)
@@ -2208,6 +2285,7 @@ void stand_linux (void)
 
 void make_standard_environ (void)
 {
+  index_modes (A68_TRUE);
   stand_moids ();
   A68_MCACHE (proc_bool) = a68_proc (M_BOOL, NO_MOID);
   A68_MCACHE (proc_char) = a68_proc (M_CHAR, NO_MOID);
@@ -2234,6 +2312,7 @@ void make_standard_environ (void)
   stand_mp_level_3 ();
   stand_transput ();
   stand_extensions ();
+  stand_torrix ();
 #if (A68_LEVEL <= 2)
   stand_longlong_bits ();
 #endif
@@ -2255,4 +2334,5 @@ void make_standard_environ (void)
 #if defined (HAVE_POSTGRESQL)
   stand_postgresql ();
 #endif
+  index_modes (A68_FALSE);
 }
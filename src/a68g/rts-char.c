@@ -147,6 +147,74 @@ void genie_elem_string (NODE_T * p)
   PUSH_VALUE (p, VALUE (ch), A68_CHAR);
 }
 
+//! @brief Copy the characters of a STRING to consecutive places.
+
+static void copy_string_elements (BYTE_T * dst, A68_ARRAY * arr, A68_TUPLE * tup)
+{
+  int len = ROW_SIZE (tup);
+  if (len > 0) {
+    BYTE_T *src = &((DEREF (BYTE_T, &ARRAY (arr)))[INDEX_1_DIM (arr, tup, LWB (tup))]);
+    int stride = STRIDE_1_DIM (arr, tup);
+    if (stride == SIZE (M_CHAR)) {
+      memcpy (dst, src, (size_t) len * SIZE (M_CHAR));
+    } else {
+      for (int k = 0; k < len; k++, src += stride, dst += SIZE (M_CHAR)) {
+        *(A68_CHAR *) dst = *(A68_CHAR *) src;
+      }
+    }
+  }
+}
+
+//! @brief Give a STRING of "n" times "len" characters, to be filled by the caller.
+
+static A68_REF give_string (NODE_T * p, int n, int len)
+{
+  A68_REF ref_str = heap_generator (p, M_STRING, DESCRIPTOR_SIZE (1));
+  A68_REF new_str = heap_generator_3 (p, M_STRING, n, len, SIZE (M_CHAR));
+  A68_ARRAY *arr; A68_TUPLE *tup;
+  GET_DESCRIPTOR (arr, tup, &ref_str);
+  DIM (arr) = 1;
+  MOID (arr) = M_CHAR;
+  ELEM_SIZE (arr) = SIZE (M_CHAR);
+  SLICE_OFFSET (arr) = 0;
+  FIELD_OFFSET (arr) = 0;
+  ARRAY (arr) = new_str;
+  LWB (tup) = 1;
+  UPB (tup) = n * len;
+  SHIFT (tup) = LWB (tup);
+  SPAN (tup) = 1;
+  return ref_str;
+}
+
+//! @brief Give STRING variable "name" a row of its own before it is sliced as a name.
+
+void unshare_string (NODE_T * p, A68_REF * name)
+{
+// A buffer grown by +:= may be shared with earlier values of the variable,
+// so an element must not be written through it. Copy it first; the next
+// +:= then starts a new buffer.
+  A68_REF *row = DEREF (A68_REF, name);
+  if (!INITIALISED (row) || IS_NIL (*row)) {
+    return;
+  }
+  A68_ARRAY *arr; A68_TUPLE *tup;
+  GET_DESCRIPTOR (arr, tup, row);
+  A68_REF buf = ARRAY (arr);
+  if (!(IS_IN_HEAP (&buf) && STATUS_TEST (REF_HANDLE (&buf), GROWABLE_MASK))) {
+    return;
+  }
+  int len = ROW_SIZE (tup);
+  A68_REF ref_str = give_string (p, 1, len);
+  GET_DESCRIPTOR (arr, tup, row);
+  A68_ARRAY *arr_2; A68_TUPLE *tup_2;
+  GET_DESCRIPTOR (arr_2, tup_2, &ref_str);
+  copy_string_elements (DEREF (BYTE_T, &ARRAY (arr_2)), arr, tup);
+  LWB (tup_2) = LWB (tup);
+  UPB (tup_2) = UPB (tup);
+  SHIFT (tup_2) = LWB (tup_2);
+  *row = ref_str;
+}
+
 //! @brief OP + = (STRING, STRING) STRING
 
 void genie_add_string (NODE_T * p)
@@ -166,40 +234,17 @@ void genie_add_string (NODE_T * p)
   GET_DESCRIPTOR (arr_1, tup_1, &a);
   int l_1 = ROW_SIZE (tup_1);
 // Sum.
-  A68_REF ref_str = heap_generator (p, M_STRING, DESCRIPTOR_SIZE (1));
-  A68_REF new_str = heap_generator_2 (p, M_STRING, l_1 + l_2, SIZE (M_CHAR));
+  A68_REF ref_str = give_string (p, 1, l_1 + l_2);
 // Calculate again since garbage collector might have moved data.
   GET_DESCRIPTOR (arr_1, tup_1, &a);
   GET_DESCRIPTOR (arr_2, tup_2, &b);
   A68_ARRAY *arr_3; A68_TUPLE *tup_3;
   GET_DESCRIPTOR (arr_3, tup_3, &ref_str);
-  DIM (arr_3) = 1;
-  MOID (arr_3) = M_CHAR;
-  ELEM_SIZE (arr_3) = SIZE (M_CHAR);
-  SLICE_OFFSET (arr_3) = 0;
-  FIELD_OFFSET (arr_3) = 0;
-  ARRAY (arr_3) = new_str;
-  LWB (tup_3) = 1;
-  UPB (tup_3) = l_1 + l_2;
-  SHIFT (tup_3) = LWB (tup_3);
-  SPAN (tup_3) = 1;
 // Add strings.
   BYTE_T *str_3 = DEREF (BYTE_T, &ARRAY (arr_3));
-  int m = 0;
-  if (ROW_SIZE (tup_1) > 0) {
-    BYTE_T *str_1 = DEREF (BYTE_T, &ARRAY (arr_1));
-    for (int k = LWB (tup_1); k <= UPB (tup_1); k++) {
-      MOVE ((BYTE_T *) & str_3[m], (BYTE_T *) & str_1[INDEX_1_DIM (arr_1, tup_1, k)], SIZE (M_CHAR));
-      m += SIZE (M_CHAR);
-    }
-  }
-  if (ROW_SIZE (tup_2) > 0) {
-    BYTE_T *str_2 = DEREF (BYTE_T, &ARRAY (arr_2));
-    for (int k = LWB (tup_2); k <= UPB (tup_2); k++) {
-      MOVE ((BYTE_T *) & str_3[m], (BYTE_T *) & str_2[INDEX_1_DIM (arr_2, tup_2, k)], SIZE (M_CHAR));
-      m += SIZE (M_CHAR);
-    }
-  }
+  copy_string_elements (str_3, arr_1, tup_1);
+  copy_string_elements (&str_3[l_1 * SIZE (M_CHAR)], arr_2, tup_2);
+  (void) tup_3;
   PUSH_REF (p, ref_str);
 }
 
@@ -213,11 +258,25 @@ void genie_times_int_string (NODE_T * p)
   POP_OBJECT (p, &k, A68_INT);
   PRELUDE_ERROR (VALUE (&k) < 0, p, ERROR_INVALID_ARGUMENT, M_INT);
   CHECK_INT_SHORTEN (p, VALUE (&k));
-  PUSH_REF (p, empty_string (p));
-  while (VALUE (&k)--) {
-    PUSH_REF (p, a);
-    genie_add_string (p);
+  CHECK_INIT (p, INITIALISED (&a), M_STRING);
+  A68_ARRAY *arr_1; A68_TUPLE *tup_1;
+  GET_DESCRIPTOR (arr_1, tup_1, &a);
+  int n = (int) VALUE (&k), len = ROW_SIZE (tup_1);
+// Copy once, then replicate the copy, rather than adding "n" times.
+  A68_REF ref_str = give_string (p, n, len);
+  GET_DESCRIPTOR (arr_1, tup_1, &a);
+  A68_ARRAY *arr_3; A68_TUPLE *tup_3;
+  GET_DESCRIPTOR (arr_3, tup_3, &ref_str);
+  if (n > 0 && len > 0) {
+    BYTE_T *str_3 = DEREF (BYTE_T, &ARRAY (arr_3));
+    int size = len * SIZE (M_CHAR);
+    copy_string_elements (str_3, arr_1, tup_1);
+    for (int m = 1; m < n; m++) {
+      memcpy (&str_3[m * size], str_3, (size_t) size);
+    }
   }
+  (void) tup_3;
+  PUSH_REF (p, ref_str);
 }
 
 //! @brief OP * = (STRING, INT) STRING
@@ -274,7 +333,59 @@ void genie_times_char_int (NODE_T * p)
 
 void genie_plusab_string (NODE_T * p)
 {
-  genie_f_and_becomes (p, M_REF_STRING, genie_add_string);
+// Appending to a buffer with room left takes amortised constant time.
+// Only a value that ends at the last character in use appends in place,
+// so other values sharing the buffer are never overwritten.
+  A68_REF b;
+  POP_REF (p, &b);
+  CHECK_INIT (p, INITIALISED (&b), M_STRING);
+  A68_REF refa;
+  POP_REF (p, &refa);
+  CHECK_REF (p, refa, M_REF_STRING);
+  A68_REF a = *DEREF (A68_REF, &refa);
+  CHECK_INIT (p, INITIALISED (&a), M_STRING);
+  A68_ARRAY *arr_1, *arr_2; A68_TUPLE *tup_1, *tup_2;
+  GET_DESCRIPTOR (arr_1, tup_1, &a);
+  GET_DESCRIPTOR (arr_2, tup_2, &b);
+  int l_1 = ROW_SIZE (tup_1), l_2 = ROW_SIZE (tup_2), first = 0;
+  BOOL_T in_place = A68_FALSE;
+  A68_REF buf = ARRAY (arr_1);
+  if (l_1 > 0 && IS_IN_HEAP (&buf) && STATUS_TEST (REF_HANDLE (&buf), GROWABLE_MASK) && OFFSET (&buf) == SIZE (M_CHAR)) {
+    if (ELEM_SIZE (arr_1) == SIZE (M_CHAR) && SPAN (tup_1) == 1 && FIELD_OFFSET (arr_1) == 0) {
+      int used = *(int *) REF_POINTER (&buf);
+      int room = SIZE (REF_HANDLE (&buf)) / SIZE (M_CHAR) - 1;
+      first = INDEX_1_DIM (arr_1, tup_1, LWB (tup_1)) / SIZE (M_CHAR);
+      in_place = (first + l_1 == used && used + l_2 <= room);
+    }
+  }
+  if (!in_place) {
+    int n = l_1 + l_2;
+    buf = heap_generator_2 (p, M_STRING, 1 + n + MAX (n / 2, MIN_STRING_BUFFER), SIZE (M_CHAR));
+    STATUS_SET (REF_HANDLE (&buf), GROWABLE_MASK);
+    OFFSET (&buf) = SIZE (M_CHAR);
+    GET_DESCRIPTOR (arr_1, tup_1, &a);
+    GET_DESCRIPTOR (arr_2, tup_2, &b);
+    copy_string_elements (ADDRESS (&buf), arr_1, tup_1);
+    first = 0;
+  }
+  copy_string_elements (&(ADDRESS (&buf)[(first + l_1) * SIZE (M_CHAR)]), arr_2, tup_2);
+  *(int *) REF_POINTER (&buf) = first + l_1 + l_2;
+// A fresh descriptor, since others may hold the old one.
+  A68_REF ref_str = heap_generator (p, M_STRING, DESCRIPTOR_SIZE (1));
+  A68_ARRAY *arr_3; A68_TUPLE *tup_3;
+  GET_DESCRIPTOR (arr_3, tup_3, &ref_str);
+  DIM (arr_3) = 1;
+  MOID (arr_3) = M_CHAR;
+  ELEM_SIZE (arr_3) = SIZE (M_CHAR);
+  SLICE_OFFSET (arr_3) = first;
+  FIELD_OFFSET (arr_3) = 0;
+  ARRAY (arr_3) = buf;
+  LWB (tup_3) = 1;
+  UPB (tup_3) = l_1 + l_2;
+  SHIFT (tup_3) = LWB (tup_3);
+  SPAN (tup_3) = 1;
+  *DEREF (A68_REF, &refa) = ref_str;
+  PUSH_REF (p, refa);
 }
 
 //! @brief OP +=: = (STRING, REF STRING) REF STRING
@@ -307,12 +418,9 @@ void genie_timesab_string (NODE_T * p)
   CHECK_REF (p, ref, M_REF_STRING);
   A68_REF a = *DEREF (A68_REF, &ref);
   CHECK_INIT (p, INITIALISED (&a), M_STRING);
-// Multiplication as repeated addition.
-  PUSH_REF (p, empty_string (p));
-  for (int i = 1; i <= VALUE (&k); i++) {
-    PUSH_REF (p, a);
-    genie_add_string (p);
-  }
+  PUSH_VALUE (p, VALUE (&k), A68_INT);
+  PUSH_REF (p, a);
+  genie_times_int_string (p);
 // The stack contains a STRING, promote to REF STRING.
   POP_REF (p, DEREF (A68_REF, &ref));
   PUSH_REF (p, ref);
@@ -337,21 +445,18 @@ int string_difference (NODE_T * p)
   int len_1 = ROW_SIZE (tup_1);
 // Compute string difference.
   int size = (len_1 > len_2 ? len_1 : len_2), diff = 0;
-  BYTE_T *str_1 = (len_1 > 0 ? DEREF (BYTE_T, &ARRAY (arr_1)) : NO_BYTE);
-  BYTE_T *str_2 = (len_2 > 0 ? DEREF (BYTE_T, &ARRAY (arr_2)) : NO_BYTE);
+  BYTE_T *str_1 = (len_1 > 0 ? &((DEREF (BYTE_T, &ARRAY (arr_1)))[INDEX_1_DIM (arr_1, tup_1, LWB (tup_1))]) : NO_BYTE);
+  BYTE_T *str_2 = (len_2 > 0 ? &((DEREF (BYTE_T, &ARRAY (arr_2)))[INDEX_1_DIM (arr_2, tup_2, LWB (tup_2))]) : NO_BYTE);
+  int stride_1 = STRIDE_1_DIM (arr_1, tup_1), stride_2 = STRIDE_1_DIM (arr_2, tup_2);
   for (int k = 0; k < size && diff == 0; k++) {
     int a = 0, b = 0;
-    if (len_1 > 0 && k < len_1) {
-      A68_CHAR *ch = (A68_CHAR *) & str_1[INDEX_1_DIM (arr_1, tup_1, LWB (tup_1) + k)];
-      a = (int) VALUE (ch);
-    } else {
-      a = 0;
+    if (k < len_1) {
+      a = (int) VALUE ((A68_CHAR *) str_1);
+      str_1 += stride_1;
     }
-    if (len_2 > 0 && k < len_2) {
-      A68_CHAR *ch = (A68_CHAR *) & str_2[INDEX_1_DIM (arr_2, tup_2, LWB (tup_2) + k)];
-      b = (int) VALUE (ch);
-    } else {
-      b = 0;
+    if (k < len_2) {
+      b = (int) VALUE ((A68_CHAR *) str_2);
+      str_2 += stride_2;
     }
     diff += (TO_UCHAR (a) - TO_UCHAR (b));
   }
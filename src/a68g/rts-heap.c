@@ -28,7 +28,9 @@
 // A mark-and-gc garbage collector defragments the heap. When called, it walks
 // the stack frames and marks the heap space that is still active. This marking
 // process is called "colouring" here since we "pour paint" into the heap.
-// The active blocks are then joined, the non-active blocks are forgotten.
+// The non-active blocks go onto free lists, from which the generator recycles
+// them without moving any object. Only when the heap gets fragmented, the 
+// active blocks are joined and the free lists are forgotten.
 // 
 // When colouring the heap, "cookies" are placed in objects as to find circular
 // references.
@@ -143,6 +145,83 @@ unt heap_available (void)
   return A68 (heap_size) - A68_HP;
 }
 
+// Freed blocks keep a link to the next block on their list in their first
+// word. Blocks on the power-of-two lists also record their size.
+
+#define FREE_NEXT(b) (*(BYTE_T **) (b))
+#define FREE_SIZE(b) (*(int *) &((b)[sizeof (BYTE_T *)]))
+
+//! @brief Free list that holds blocks of "size" bytes.
+
+static int free_list_index (int size)
+{
+  int units = size / A68_ALIGNMENT;
+  if (units <= HEAP_SMALL_CLASSES) {
+    return units - 1;
+  }
+  int k = HEAP_SMALL_CLASSES;
+  for (units /= HEAP_SMALL_CLASSES; units > 1 && k < HEAP_FREE_LISTS - 1; units >>= 1) {
+    k++;
+  }
+  return k;
+}
+
+//! @brief Put a block on its free list.
+
+static void release_block (BYTE_T * b, int size)
+{
+  if (size > 0) {
+    int k = free_list_index (size);
+    FREE_NEXT (b) = A68_GC (free_blocks)[k];
+    if (k >= HEAP_SMALL_CLASSES) {
+      FREE_SIZE (b) = size;
+    }
+    A68_GC (free_blocks)[k] = b;
+    A68_GC (hole_bytes) += size;
+  }
+}
+
+//! @brief Take a block of "size" bytes from the free lists, or NO_BYTE.
+
+static BYTE_T *take_block (int size)
+{
+  int k = free_list_index (size);
+  if (k < HEAP_SMALL_CLASSES) {
+// Exact fit, else split a large block.
+    BYTE_T *b = A68_GC (free_blocks)[k];
+    if (b != NO_BYTE) {
+      A68_GC (free_blocks)[k] = FREE_NEXT (b);
+      A68_GC (hole_bytes) -= size;
+      return b;
+    }
+    k = HEAP_SMALL_CLASSES;
+  }
+// First fit. Any block on a higher list is large enough.
+  for (; k < HEAP_FREE_LISTS; k++) {
+    for (BYTE_T **q = &(A68_GC (free_blocks)[k]); *q != NO_BYTE; q = &(FREE_NEXT (*q))) {
+      BYTE_T *b = *q;
+      int bsize = FREE_SIZE (b);
+      if (bsize >= size) {
+        *q = FREE_NEXT (b);
+        A68_GC (hole_bytes) -= bsize;
+        release_block (&b[size], bsize - size);
+        return b;
+      }
+    }
+  }
+  return NO_BYTE;
+}
+
+//! @brief Forget all free lists.
+
+static void clear_free_lists (void)
+{
+  for (int k = 0; k < HEAP_FREE_LISTS; k++) {
+    A68_GC (free_blocks)[k] = NO_BYTE;
+  }
+  A68_GC (hole_bytes) = 0;
+}
+
 //! @brief Initialise heap management.
 
 void genie_init_heap (NODE_T * p)
@@ -158,26 +237,59 @@ void genie_init_heap (NODE_T * p)
   }
   A68_GC (seconds) = 0;
   A68_GC (total) = 0;
+  A68_GC (allocated) = 0;
   A68_GC (sweeps) = 0;
   A68_GC (refused) = 0;
   A68_GC (preemptive) = A68_FALSE;
+  A68_GC (heap_budget) = 0;
+  A68_GC (handle_budget) = 0;
+  clear_free_lists ();
   ABEND (A68 (fixed_heap_pointer) >= (A68 (heap_size) - MIN_MEM_SIZE), ERROR_OUT_OF_CORE, __func__);
   A68_HP = A68 (fixed_heap_pointer);
   A68 (heap_is_fluid) = A68_FALSE;
-// Assign handle space.
-  A68_HANDLE *z = (A68_HANDLE *) A68_HANDLES;
-  A68_GC (available_handles) = z;
-  A68_GC (busy_handles) = NO_HANDLE;
+// Assign handle space. The map of busy handles follows the table.
   int N = (unt) A68 (handle_pool_size) / SIZE_ALIGNED (A68_HANDLE);
+  int W = (N + HANDLE_MAP_BITS - 1) / HANDLE_MAP_BITS;
+  N = ((unt) A68 (handle_pool_size) - A68_ALIGN (W * (int) sizeof (unt))) / SIZE_ALIGNED (A68_HANDLE);
+  W = (N + HANDLE_MAP_BITS - 1) / HANDLE_MAP_BITS;
   A68_GC (free_handles) = N;
   A68_GC (max_handles) = N;
-  for (int k = 0; k < N; k++) {
-    STATUS (&(z[k])) = NULL_MASK;
-    POINTER (&(z[k])) = NO_BYTE;
-    SIZE (&(z[k])) = 0;
-    NEXT (&z[k]) = (k == N - 1 ? NO_HANDLE : &z[k + 1]);
-    PREVIOUS (&z[k]) = (k == 0 ? NO_HANDLE : &z[k - 1]);
+  A68_GC (handle_map) = (unt *) &(A68_HANDLES[N * SIZE_ALIGNED (A68_HANDLE)]);
+  A68_GC (map_words) = W;
+  A68_GC (free_word) = 0;
+  A68_GC (top_word) = 0;
+  A68_GC (clean_word) = 0;
+  for (int k = 0; k < W; k++) {
+    A68_GC (handle_map)[k] = 0;
+  }
+// Handles are cleared when allocation first reaches them, see give_handle.
+// Touching the whole table here would dominate the run time of small programs.
+}
+
+//! @brief Number of handles that have been cleared for use.
+
+static UNSIGNED_T clean_handles (void)
+{
+  UNSIGNED_T n = A68_GC (clean_word) * HANDLE_MAP_BITS;
+  return n < A68_GC (max_handles) ? n : A68_GC (max_handles);
+}
+
+//! @brief Index of the lowest bit that is set in a word of the handle map.
+
+static inline int lowest_bit (unt m)
+{
+#if defined (__GNUC__)
+  return __builtin_ctz (m);
+#else
+  int k = 0;
+  for (; (m & 0xffff) == 0; m >>= 16) {
+    k += 16;
+  }
+  for (; (m & 0x1) == 0; m >>= 1) {
+    k++;
   }
+  return k;
+#endif
 }
 
 //! @brief Whether mode must be coloured.
@@ -329,57 +441,134 @@ void colour_heap (ADDR_T fp)
   }
 }
 
-//! @brief Join all active blocks in the heap.
+//! @brief Handle that a word in memory may point at, or NO_HANDLE.
 
-void defragment_heap (void)
+static A68_HANDLE *word_to_handle (BYTE_T * w)
 {
   A68_HANDLE *z;
-// Free handles.
-  z = A68_GC (busy_handles);
-  while (z != NO_HANDLE) {
-    if (!(STATUS_TEST (z, COLOUR_MASK)) && !(STATUS_TEST (z, BLOCK_GC_MASK))) {
-      A68_HANDLE *y = NEXT (z);
-      if (PREVIOUS (z) == NO_HANDLE) {
-        A68_GC (busy_handles) = NEXT (z);
-      } else {
-        NEXT (PREVIOUS (z)) = NEXT (z);
-      }
-      if (NEXT (z) != NO_HANDLE) {
-        PREVIOUS (NEXT (z)) = PREVIOUS (z);
-      }
-      NEXT (z) = A68_GC (available_handles);
-      PREVIOUS (z) = NO_HANDLE;
-      if (NEXT (z) != NO_HANDLE) {
-        PREVIOUS (NEXT (z)) = z;
-      }
-      A68_GC (available_handles) = z;
-      STATUS_CLEAR (z, ALLOCATED_MASK);
-      A68_GC (freed) += SIZE (z);
-      A68_GC (free_handles)++;
-      z = y;
-    } else {
-      FORWARD (z);
+  memcpy (&z, w, sizeof (A68_HANDLE *));
+  A68_HANDLE *lwb = (A68_HANDLE *) A68_HANDLES, *upb = &lwb[clean_handles ()];
+  if (z < lwb || z >= upb) {
+    return NO_HANDLE;
+  } else if (((BYTE_T *) z - (BYTE_T *) lwb) % sizeof (A68_HANDLE) != 0) {
+    return NO_HANDLE;
+  } else if (!STATUS_TEST (z, ALLOCATED_MASK)) {
+    return NO_HANDLE;
+  } else {
+    return z;
+  }
+}
+
+//! @brief Colour a block, and what it may point at, without knowing its mode.
+
+static void colour_block_conservative (A68_HANDLE * z)
+{
+  if (STATUS_TEST (z, COOKIE_MASK)) {
+    return;
+  }
+  LOW_STACK_ALERT (NO_NODE);
+  STATUS_SET (z, (COOKIE_MASK | COLOUR_MASK));
+  BYTE_T *u = POINTER (z);
+  for (int k = 0; k + (int) sizeof (A68_HANDLE *) <= SIZE (z); k += sizeof (A68_HANDLE *)) {
+    A68_HANDLE *y = word_to_handle (&u[k]);
+    if (y != NO_HANDLE) {
+      colour_block_conservative (y);
     }
   }
-// There can be no uncoloured allocated handle.
-  for (z = A68_GC (busy_handles); z != NO_HANDLE; FORWARD (z)) {
-    ABEND (!(STATUS_TEST (z, COLOUR_MASK)) && !(STATUS_TEST (z, BLOCK_GC_MASK)), ERROR_INTERNAL_CONSISTENCY, __func__);
+}
+
+//! @brief Colour objects that intermediate results on the stack may refer to.
+
+void colour_stack (ADDR_T lwb, ADDR_T upb)
+{
+// The stack holds no mode information, so any word that points at a busy
+// handle is taken as a REF. This can only keep garbage alive, never free
+// a live object. Since names refer to handles, not to the heap itself,
+// compaction leaves these intermediate results valid.
+  for (ADDR_T k = A68_ALIGN (lwb); k + (ADDR_T) sizeof (A68_HANDLE *) <= upb; k += sizeof (A68_HANDLE *)) {
+    A68_HANDLE *z = word_to_handle (STACK_ADDRESS (k));
+    if (z != NO_HANDLE) {
+      colour_block_conservative (z);
+    }
   }
-// Defragment the heap.
-  A68_HP = A68 (fixed_heap_pointer);
-  for (z = A68_GC (busy_handles); z != NO_HANDLE && NEXT (z) != NO_HANDLE; FORWARD (z)) {
-    ;
+}
+
+//! @brief Order handles by the address of their block.
+
+static int compare_handles (const void *x, const void *y)
+{
+  BYTE_T *u = POINTER (*(A68_HANDLE **) x), *v = POINTER (*(A68_HANDLE **) y);
+  return (u < v ? -1 : (u > v ? 1 : 0));
+}
+
+//! @brief Join all active blocks in the heap.
+
+static void compact_heap (void)
+{
+// Since freed blocks are recycled, the handle table is not in address order.
+  A68_HANDLE *z, *h = (A68_HANDLE *) A68_HANDLES;
+  int n = 0, busy = (int) (A68_GC (max_handles) - A68_GC (free_handles));
+  A68_HANDLE **order = (A68_HANDLE **) a68_alloc ((size_t) busy * sizeof (A68_HANDLE *), __func__, __LINE__);
+  for (UNSIGNED_T w = 0; w < A68_GC (top_word); w++) {
+    for (unt m = A68_GC (handle_map)[w]; m != 0; m &= m - 1) {
+      order[n++] = &h[w * HANDLE_MAP_BITS + lowest_bit (m)];
+    }
   }
-  for (; z != NO_HANDLE; BACKWARD (z)) {
+  ABEND (n != busy, ERROR_INTERNAL_CONSISTENCY, __func__);
+  qsort (order, (size_t) n, sizeof (A68_HANDLE *), compare_handles);
+  clear_free_lists ();
+  A68_HP = A68 (fixed_heap_pointer);
+  for (int k = 0; k < n; k++) {
+    z = order[k];
     BYTE_T *dst = HEAP_ADDRESS (A68_HP);
     if (dst != POINTER (z)) {
       MOVE (dst, POINTER (z), (unt) SIZE (z));
     }
-    STATUS_CLEAR (z, (COLOUR_MASK | COOKIE_MASK));
     POINTER (z) = dst;
     A68_HP += (SIZE (z));
     ABEND (A68_HP % A68_ALIGNMENT != 0, ERROR_ALIGNMENT, __func__);
   }
+  a68_free (order);
+}
+
+//! @brief Free inactive blocks, and compact the heap when it is fragmented.
+
+void defragment_heap (void)
+{
+// Free handles, scanning the map a word at a time.
+  A68_HANDLE *h = (A68_HANDLE *) A68_HANDLES;
+  unt *map = A68_GC (handle_map);
+  UNSIGNED_T top = 0;
+  for (UNSIGNED_T w = 0; w < A68_GC (top_word); w++) {
+    for (unt m = map[w]; m != 0; m &= m - 1) {
+      int b = lowest_bit (m);
+      A68_HANDLE *z = &h[w * HANDLE_MAP_BITS + b];
+      if (!(STATUS_TEST (z, COLOUR_MASK)) && !(STATUS_TEST (z, BLOCK_GC_MASK))) {
+        map[w] &= ~(1u << b);
+        if (w < A68_GC (free_word)) {
+          A68_GC (free_word) = w;
+        }
+        STATUS_CLEAR (z, ALLOCATED_MASK);
+        release_block (POINTER (z), SIZE (z));
+        A68_GC (freed) += SIZE (z);
+        A68_GC (free_handles)++;
+      } else {
+        STATUS_CLEAR (z, (COLOUR_MASK | COOKIE_MASK));
+      }
+    }
+    if (map[w] != 0) {
+      top = w + 1;
+    }
+  }
+  A68_GC (top_word) = top;
+// Freed blocks are reused in place. Only move objects when holes take a
+// large part of the heap, or when more space is in holes than on top.
+  REAL_T used = (REAL_T) (A68_HP - A68 (fixed_heap_pointer));
+  if (A68_GC (hole_bytes) > 0) {
+    if (A68_GC (hole_bytes) > DEFAULT_FRAGMENTATION * used || A68_GC (hole_bytes) > heap_available ()) {
+      compact_heap ();
+    }
+  }
 }
 
 //! @brief Clean up garbage and defragment the heap.
@@ -387,7 +576,6 @@ void defragment_heap (void)
 void gc_heap (NODE_T * p, ADDR_T fp)
 {
 // Must start with fp = current frame_pointer.
-  A68_HANDLE *z;
   REAL_T t0, t1;
 #if defined (BUILD_PARALLEL_CLAUSE)
   if (OTHER_THREAD (FRAME_THREAD_ID (A68_FP), A68_PAR (main_thread_id))) {
@@ -399,20 +587,20 @@ void gc_heap (NODE_T * p, ADDR_T fp)
     A68_GC (refused)++;
     return;
   }
-// Take no risk when intermediate results are on the stack.
-  if (A68_SP != A68 (stack_start)) {
-    A68_GC (refused)++;
-    return;
-  }
 // Give it a whirl then.
   t0 = seconds ();
 // Unfree handles are subject to inspection.
 // Release them all before colouring.
-  for (z = A68_GC (busy_handles); z != NO_HANDLE; FORWARD (z)) {
-    STATUS_CLEAR (z, (COLOUR_MASK | COOKIE_MASK));
+  A68_HANDLE *h = (A68_HANDLE *) A68_HANDLES;
+  for (UNSIGNED_T w = 0; w < A68_GC (top_word); w++) {
+    for (unt m = A68_GC (handle_map)[w]; m != 0; m &= m - 1) {
+      STATUS_CLEAR (&h[w * HANDLE_MAP_BITS + lowest_bit (m)], (COLOUR_MASK | COOKIE_MASK));
+    }
   }
 // Pour paint into the heap to reveal active objects.
   colour_heap (fp);
+// Intermediate results on the stack are roots as well.
+  colour_stack (A68 (stack_start), A68_SP);
 // Start freeing and compacting.
   A68_GC (freed) = 0;
   defragment_heap ();
@@ -420,6 +608,9 @@ void gc_heap (NODE_T * p, ADDR_T fp)
   A68_GC (total) += A68_GC (freed);
   A68_GC (sweeps)++;
   A68_GC (preemptive) = A68_FALSE;
+// Next preemptive sweep only after a fair amount of new allocation.
+  A68_GC (heap_budget) = A68_HP + (ADDR_T) (DEFAULT_GC_BUDGET * (A68 (heap_size) - A68_HP));
+  A68_GC (handle_budget) = (A68_GC (max_handles) - A68_GC (free_handles)) + (UNSIGNED_T) (DEFAULT_GC_BUDGET * A68_GC (free_handles));
   t1 = seconds ();
 // C optimiser can make last digit differ, so next condition is 
 // needed to determine a positive time difference
@@ -436,29 +627,42 @@ void gc_heap (NODE_T * p, ADDR_T fp)
 
 A68_HANDLE *give_handle (NODE_T * p, MOID_T * a68m)
 {
-  if (A68_GC (available_handles) != NO_HANDLE) {
-    A68_HANDLE *x = A68_GC (available_handles);
-    A68_GC (available_handles) = NEXT (x);
-    if (A68_GC (available_handles) != NO_HANDLE) {
-      PREVIOUS (A68_GC (available_handles)) = NO_HANDLE;
-    }
-    STATUS (x) = ALLOCATED_MASK;
-    POINTER (x) = NO_BYTE;
-    SIZE (x) = 0;
-    MOID (x) = a68m;
-    NEXT (x) = A68_GC (busy_handles);
-    PREVIOUS (x) = NO_HANDLE;
-    if (NEXT (x) != NO_HANDLE) {
-      PREVIOUS (NEXT (x)) = x;
+// Take the lowest free handle, so busy handles stay packed in the table.
+  unt *map = A68_GC (handle_map);
+  UNSIGNED_T w = A68_GC (free_word);
+  while (w < A68_GC (map_words) && map[w] == ~0u) {
+    w++;
+  }
+  A68_GC (free_word) = w;
+  if (w < A68_GC (map_words)) {
+    int b = lowest_bit (~map[w]);
+    UNSIGNED_T k = w * HANDLE_MAP_BITS + b;
+    if (k < A68_GC (max_handles)) {
+      A68_HANDLE *h = (A68_HANDLE *) A68_HANDLES;
+      for (; A68_GC (clean_word) <= w; A68_GC (clean_word)++) {
+        UNSIGNED_T j = A68_GC (clean_word) * HANDLE_MAP_BITS;
+        for (int m = 0; m < HANDLE_MAP_BITS && j < A68_GC (max_handles); m++, j++) {
+          STATUS (&h[j]) = NULL_MASK;
+          POINTER (&h[j]) = NO_BYTE;
+          SIZE (&h[j]) = 0;
+        }
+      }
+      A68_HANDLE *x = &h[k];
+      map[w] |= (1u << b);
+      if (w >= A68_GC (top_word)) {
+        A68_GC (top_word) = w + 1;
+      }
+      STATUS (x) = ALLOCATED_MASK;
+      POINTER (x) = NO_BYTE;
+      SIZE (x) = 0;
+      MOID (x) = a68m;
+      A68_GC (free_handles)--;
+      return x;
     }
-    A68_GC (busy_handles) = x;
-    A68_GC (free_handles)--;
-    return x;
-  } else {
-// Do not auto-GC!.
-    diagnostic (A68_RUNTIME_ERROR, p, ERROR_OUT_OF_CORE);
-    exit_genie (p, A68_RUNTIME_ERROR);
   }
+// Do not auto-GC!.
+  diagnostic (A68_RUNTIME_ERROR, p, ERROR_OUT_OF_CORE);
+  exit_genie (p, A68_RUNTIME_ERROR);
   return NO_HANDLE;
 }
 
@@ -468,21 +672,33 @@ A68_REF heap_generator (NODE_T * p, MOID_T * mode, int size)
 {
   ABEND (size < 0, ERROR_INVALID_SIZE, __func__);
   size = A68_ALIGN (size);
-  if (heap_available () >= size) {
+// Recycle a freed block, else take space from the top of the heap.
+  BYTE_T *b = NO_BYTE;
+  if (size > 0 && A68_GC (hole_bytes) >= size) {
+    b = take_block (size);
+  }
+  if (b == NO_BYTE && heap_available () >= size) {
+    b = HEAP_ADDRESS (A68_HP);
+    A68_HP += size;
+  }
+  if (b != NO_BYTE) {
     A68_REF z;
     STATUS (&z) = (STATUS_MASK_T) (INIT_MASK | IN_HEAP_MASK);
     OFFSET (&z) = 0;
     A68_HANDLE *x = give_handle (p, mode);
     SIZE (x) = size;
-    POINTER (x) = HEAP_ADDRESS (A68_HP);
+    POINTER (x) = b;
     FILL (POINTER (x), 0, size);
+    A68_GC (allocated) += size;
     REF_SCOPE (&z) = PRIMAL_SCOPE;
     REF_HANDLE (&z) = x;
     ABEND (((long) ADDRESS (&z)) % A68_ALIGNMENT != 0, ERROR_ALIGNMENT, __func__);
-    A68_HP += size;
+    UNSIGNED_T busy = A68_GC (max_handles) - A68_GC (free_handles);
     REAL_T _f_ = (REAL_T) A68_HP / (REAL_T) A68 (heap_size);
-    REAL_T _g_ = (REAL_T) (A68_GC (max_handles) - A68_GC (free_handles)) / (REAL_T) A68_GC (max_handles);
-    if (_f_ > DEFAULT_PREEMPTIVE || _g_ > DEFAULT_PREEMPTIVE) {
+    REAL_T _g_ = (REAL_T) busy / (REAL_T) A68_GC (max_handles);
+    if (_f_ > DEFAULT_PREEMPTIVE && A68_HP >= A68_GC (heap_budget)) {
+      A68_GC (preemptive) = A68_TRUE;
+    } else if (_g_ > DEFAULT_PREEMPTIVE && busy >= A68_GC (handle_budget)) {
       A68_GC (preemptive) = A68_TRUE;
     }
     return z;
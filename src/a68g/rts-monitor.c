@@ -1557,19 +1557,24 @@ void list (FILE_T f, NODE_T * p, int n, int m)
 
 //! @brief Overview of the heap.
 
-void show_heap (FILE_T f, NODE_T * p, A68_HANDLE * z, int top, int n)
+void show_heap (FILE_T f, NODE_T * p, int top, int n)
 {
   int k = 0, m = n, sum = 0;
   (void) p;
   ASSERT (a68_bufprt (A68 (output_line), SNPRINTF_SIZE, "size=%u available=%d garbage collections=" A68_LD, A68 (heap_size), heap_available (), A68_GC (sweeps)) >= 0);
   WRITELN (f, A68 (output_line));
-  for (; z != NO_HANDLE; FORWARD (z), k++) {
-    if (n > 0 && sum <= top) {
-      n--;
-      indent_crlf (f);
-      ASSERT (a68_bufprt (A68 (output_line), SNPRINTF_SIZE, "heap(%p+%d) %s", (void *) POINTER (z), SIZE (z), moid_to_string (MOID (z), MOID_WIDTH, NO_NODE)) >= 0);
-      WRITE (f, A68 (output_line));
-      sum += SIZE (z);
+  A68_HANDLE *h = (A68_HANDLE *) A68_HANDLES;
+  for (UNSIGNED_T j = 0; j < A68_GC (max_handles) && j < A68_GC (top_word) * HANDLE_MAP_BITS; j++) {
+    A68_HANDLE *z = &h[j];
+    if (STATUS_TEST (z, ALLOCATED_MASK)) {
+      if (n > 0 && sum <= top) {
+        n--;
+        indent_crlf (f);
+        ASSERT (a68_bufprt (A68 (output_line), SNPRINTF_SIZE, "heap(%p+%d) %s", (void *) POINTER (z), SIZE (z), moid_to_string (MOID (z), MOID_WIDTH, NO_NODE)) >= 0);
+        WRITE (f, A68 (output_line));
+        sum += SIZE (z);
+      }
+      k++;
     }
   }
   ASSERT (a68_bufprt (A68 (output_line), SNPRINTF_SIZE, "printed %d out of %d handles", m, k) >= 0);
@@ -1819,7 +1824,7 @@ BOOL_T single_stepper (NODE_T * p, char *cmd)
     if (top <= 0) {
       top = A68 (heap_size);
     }
-    show_heap (A68_STDOUT, p, A68_GC (busy_handles), top, A68 (term_heigth) - 4);
+    show_heap (A68_STDOUT, p, top, A68 (term_heigth) - 4);
     return A68_FALSE;
   } else if (match_string (cmd, "APropos", NULL_CHAR) || match_string (cmd, "Help", NULL_CHAR) || match_string (cmd, "INfo", NULL_CHAR)) {
     apropos (A68_STDOUT, NO_TEXT, "monitor");
@@ -43,6 +43,7 @@
 
 void save_stacks (pthread_t);
 void restore_stacks (pthread_t);
+void await_parallel_units (pthread_t);
 
 #define SAVE_STACK(stk, st, si) {\
   A68_STACK_DESCRIPTOR *s = (stk);\
@@ -121,6 +122,8 @@ void genie_abend_thread (void)
   int k;
   GET_THREAD_INDEX (k, pthread_self ());
   ACTIVE (&(A68_PAR (context)[k])) = A68_FALSE;
+// Wake up parents awaiting completion of their units.
+  ABEND (pthread_cond_broadcast (&A68_PAR (unit_done)) != 0, ERROR_THREAD_FAULT, __func__);
   UNLOCK_THREAD;
   pthread_exit (NULL);
 }
@@ -149,23 +152,6 @@ void genie_abend_all_threads (NODE_T * p, jmp_buf * jump_stat, NODE_T * label)
   }
 }
 
-//! @brief Save this thread and try to start another.
-
-void try_change_thread (NODE_T * p)
-{
-  if (is_main_thread ()) {
-    diagnostic (A68_RUNTIME_ERROR, p, ERROR_PARALLEL_OUTSIDE);
-    exit_genie (p, A68_RUNTIME_ERROR);
-  } else {
-// Release the unit_sema so another thread can take it up ...
-    save_stacks (pthread_self ());
-    UNLOCK_THREAD;
-// ... and take it up again!.
-    LOCK_THREAD;
-    restore_stacks (pthread_self ());
-  }
-}
-
 //! @brief Store the stacks of threads.
 
 void save_stacks (pthread_t t)
@@ -219,6 +205,25 @@ void check_parallel_units (BOOL_T * active, pthread_t parent)
   }
 }
 
+//! @brief Await completion of the parallel units spawned by a thread.
+
+void await_parallel_units (pthread_t parent)
+{
+// The parent sleeps on 'unit_done' instead of spinning on 'unit_sema',
+// so it no longer competes with its units for the lock, nor swaps its
+// stacks in and out on every try. Units signal 'unit_done' when they end.
+  BOOL_T units_active = A68_TRUE;
+  while (units_active) {
+    units_active = A68_FALSE;
+    check_parallel_units (&units_active, parent);
+    if (units_active) {
+      save_stacks (parent);
+      ABEND (pthread_cond_wait (&A68_PAR (unit_done), &A68_PAR (unit_sema)) != 0, ERROR_THREAD_FAULT, __func__);
+      restore_stacks (parent);
+    }
+  }
+}
+
 //! @brief Execute one unit from a PAR clause.
 
 void *start_unit (void *arg)
@@ -315,14 +320,7 @@ void *start_genie_parallel (void *arg)
   NODE_T *p = (NODE_T *) (UNIT (&(A68_PAR (context)[k])));
 // This is the thread spawned by the main thread, we spawn parallel units and await their completion.
   start_parallel_units (SUB (p), t);
-  BOOL_T units_active;
-  do {
-    units_active = A68_FALSE;
-    check_parallel_units (&units_active, pthread_self ());
-    if (units_active) {
-      try_change_thread (p);
-    }
-  } while (units_active);
+  await_parallel_units (t);
   genie_abend_thread ();
   return (void *) NULL;
 }
@@ -424,17 +422,10 @@ PROP_T genie_parallel (NODE_T * p)
     }
   } else {
 // Not in the main thread, spawn parallel units and await completion.
-    BOOL_T units_active;
     pthread_t t = pthread_self ();
 // Spawn parallel units.
     start_parallel_units (SUB (p), t);
-    do {
-      units_active = A68_FALSE;
-      check_parallel_units (&units_active, t);
-      if (units_active) {
-        try_change_thread (p);
-      }
-    } while (units_active);
+    await_parallel_units (t);
   }
   return GPROP (p);
 }
@@ -0,0 +1,454 @@
+//! @file rts-profile.c
+//! @author J. Marcel van der Veer
+
+//! @section Copyright
+//!
+//! This file is part of Algol68G - an Algol 68 compiler-interpreter.
+//! Copyright 2001-2024 J. Marcel van der Veer [algol68g@xs4all.nl].
+
+//! @section License
+//!
+//! This program is free software; you can redistribute it and/or modify it
+//! under the terms of the GNU General Public License as published by the
+//! Free Software Foundation; either version 3 of the License, or
+//! (at your option) any later version.
+//!
+//! This program is distributed in the hope that it will be useful, but
+//! WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+//! or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+//! more details. You should have received a copy of the GNU General Public
+//! License along with this program. If not, see [http://www.gnu.org/licenses/].
+
+//! @section Synopsis
+//!
+//! Profiler for the interpreter.
+
+// With --profile every unit in a serial clause carries PROFILE_MASK, so
+// GENIE_UNIT_TRACE hands it to profile_unit, and genie_call_procedure brackets
+// routine bodies with profile_call and profile_return. Each activation is a
+// frame on a profile stack that accounts calls, inclusive and exclusive
+// wall-clock time and heap bytes allocated.
+//
+// Frames also point into a tree of calling contexts. The exclusive time of
+// each context is written as a collapsed stack, the input format for flame
+// graph tools.
+//
+// A jump out of a unit or routine skips the matching exit hook. Frames
+// therefore record their depth on the system stack; a frame at that depth
+// or deeper is stale once execution resumes above it, and is closed then.
+
+#include "a68g.h"
+#include "a68g-genie.h"
+#include "a68g-prelude.h"
+
+#define PROFILE_STACK_SIZE 256
+#define PROFILE_TEXT_WIDTH (BUFFER_SIZE - 64)
+
+//! @brief Wall-clock time in seconds.
+
+static REAL_T profile_clock (void)
+{
+#if defined (BUILD_WIN32)
+  return seconds ();
+#else
+  struct timespec t;
+  (void) clock_gettime (CLOCK_MONOTONIC, &t);
+  return (REAL_T) t.tv_sec + 1.0e-9 * (REAL_T) t.tv_nsec;
+#endif
+}
+
+//! @brief Whether this activation is to be profiled.
+
+static BOOL_T profile_thread (void)
+{
+#if defined (BUILD_PARALLEL_CLAUSE)
+// The profile stack is not shared between threads.
+  return is_main_thread ();
+#else
+  return A68_TRUE;
+#endif
+}
+
+//! @brief Depth of "sp" on the system stack.
+
+static ptrdiff_t system_depth (BYTE_T * sp)
+{
+  return ABS (A68 (system_stack_offset) - sp);
+}
+
+//! @brief Profile record for node "p".
+
+static PROFILE_T *profile_of (NODE_T * p)
+{
+  if (PROFILE (GINFO (p)) == NO_PROFILE) {
+    PROFILE_T *z = (PROFILE_T *) get_heap_space ((size_t) SIZE_ALIGNED (PROFILE_T));
+    NODE (z) = p;
+    NAME (z) = NO_TEXT;
+    ACTIVE (z) = 0;
+    COUNT (z) = 0;
+    HEAP (z) = 0;
+    INCLUSIVE (z) = 0;
+    EXCLUSIVE (z) = 0;
+    NEXT (z) = A68_PROF (records);
+    A68_PROF (records) = z;
+    PROFILE (GINFO (p)) = z;
+  }
+  return PROFILE (GINFO (p));
+}
+
+//! @brief New calling context for "routine" under "parent".
+
+static PROFILE_CONTEXT_T *new_context (PROFILE_CONTEXT_T * parent, PROFILE_T * routine)
+{
+  PROFILE_CONTEXT_T *z = (PROFILE_CONTEXT_T *) get_heap_space ((size_t) SIZE_ALIGNED (PROFILE_CONTEXT_T));
+  ROUTINE (z) = routine;
+  SELF_TIME (z) = 0;
+  PARENT (z) = parent;
+  SUB (z) = NO_PROFILE_CONTEXT;
+  NEXT (z) = NO_PROFILE_CONTEXT;
+  if (parent != NO_PROFILE_CONTEXT) {
+    NEXT (z) = SUB (parent);
+    SUB (parent) = z;
+  }
+  return z;
+}
+
+//! @brief Calling context of "routine" when called from "parent".
+
+static PROFILE_CONTEXT_T *sub_context (PROFILE_CONTEXT_T * parent, PROFILE_T * routine)
+{
+// Direct recursion stays in one context, which keeps the tree shallow.
+  if (ROUTINE (parent) == routine) {
+    return parent;
+  }
+  for (PROFILE_CONTEXT_T *z = SUB (parent); z != NO_PROFILE_CONTEXT; FORWARD (z)) {
+    if (ROUTINE (z) == routine) {
+      return z;
+    }
+  }
+  return new_context (parent, routine);
+}
+
+//! @brief Close the top frame at time "now".
+
+static void close_profile_frame (REAL_T now)
+{
+  PROFILE_FRAME_T *f = &(A68_PROF (stack)[--A68_PROF (sp)]);
+  PROFILE_T *z = PROFILE (f);
+  REAL_T span = now - START (f);
+  UNSIGNED_T heap = A68_GC (allocated) - HEAP (f);
+  BOOL_T routine = (BOOL_T) (ROUTINE (CALL_CONTEXT (f)) == z);
+// A routine's own cost excludes the routines it calls; a unit's excludes nested units.
+  if (routine) {
+    EXCLUSIVE (z) += span - CALLEES (f);
+    HEAP (z) += heap - CALLEE_HEAP (f);
+  } else {
+    EXCLUSIVE (z) += span - CHILDREN (f);
+    HEAP (z) += heap - CHILD_HEAP (f);
+  }
+  SELF_TIME (CALL_CONTEXT (f)) += span - CHILDREN (f);
+// Count recursive activations once in the inclusive time.
+  if (--ACTIVE (z) == 0) {
+    INCLUSIVE (z) += span;
+  }
+  if (A68_PROF (sp) > 0) {
+    PROFILE_FRAME_T *g = &(A68_PROF (stack)[A68_PROF (sp) - 1]);
+    CHILDREN (g) += span;
+    CHILD_HEAP (g) += heap;
+  }
+  if (routine && CALLER (f) >= 0) {
+    PROFILE_FRAME_T *g = &(A68_PROF (stack)[CALLER (f)]);
+    CALLEES (g) += span;
+    CALLEE_HEAP (g) += heap;
+  }
+}
+
+//! @brief Close frames at system stack depth "depth" or deeper.
+
+static void unwind_profile (ptrdiff_t depth, REAL_T now)
+{
+  while (A68_PROF (sp) > 0 && SYSTEM_DEPTH (&(A68_PROF (stack)[A68_PROF (sp) - 1])) >= depth) {
+    close_profile_frame (now);
+  }
+}
+
+//! @brief Open a frame for "z" at system stack position "sp".
+
+static void open_profile_frame (PROFILE_T * z, BYTE_T * sp, BOOL_T routine)
+{
+  REAL_T now = profile_clock ();
+  ptrdiff_t depth = system_depth (sp);
+  unwind_profile (depth, now);
+  if (A68_PROF (sp) == A68_PROF (size)) {
+    int size = 2 * A68_PROF (size);
+    PROFILE_FRAME_T *stack = (PROFILE_FRAME_T *) get_heap_space ((size_t) size * sizeof (PROFILE_FRAME_T));
+    COPY (stack, A68_PROF (stack), A68_PROF (size) * (int) sizeof (PROFILE_FRAME_T));
+    a68_free (A68_PROF (stack));
+    A68_PROF (stack) = stack;
+    A68_PROF (size) = size;
+  }
+  PROFILE_CONTEXT_T *context = A68_PROF (root);
+  int caller = -1;
+  if (A68_PROF (sp) > 0) {
+    PROFILE_FRAME_T *g = &(A68_PROF (stack)[A68_PROF (sp) - 1]);
+    context = CALL_CONTEXT (g);
+    caller = (ROUTINE (context) == PROFILE (g) ? A68_PROF (sp) - 1 : CALLER (g));
+  }
+  PROFILE_FRAME_T *f = &(A68_PROF (stack)[A68_PROF (sp)++]);
+  PROFILE (f) = z;
+  CALL_CONTEXT (f) = (routine ? sub_context (context, z) : context);
+  SYSTEM_DEPTH (f) = depth;
+  CALLER (f) = caller;
+  START (f) = now;
+  CHILDREN (f) = CALLEES (f) = 0;
+  HEAP (f) = A68_GC (allocated);
+  CHILD_HEAP (f) = CALLEE_HEAP (f) = 0;
+  COUNT (z)++;
+  ACTIVE (z)++;
+}
+
+//! @brief Execute unit "p" while profiling.
+
+void profile_unit (NODE_T * p)
+{
+  if (!OPTION_PROFILE (&A68_JOB) || A68_PROF (stack) == NO_VAR || !profile_thread ()) {
+    GENIE_UNIT (p);
+    return;
+  }
+  BYTE_T sp;
+  open_profile_frame (profile_of (p), &sp, A68_FALSE);
+  GENIE_UNIT (p);
+  unwind_profile (system_depth (&sp), profile_clock ());
+}
+
+//! @brief Account entry of routine text "body"; "sp" is in the caller's frame.
+
+void profile_call (NODE_T * body, BYTE_T * sp)
+{
+  if (A68_PROF (stack) != NO_VAR && GINFO (body) != NO_GINFO && profile_thread ()) {
+    open_profile_frame (profile_of (body), sp, A68_TRUE);
+  }
+}
+
+//! @brief Account return from the routine entered with profile_call.
+
+void profile_return (BYTE_T * sp)
+{
+  if (A68_PROF (stack) != NO_VAR && profile_thread ()) {
+    unwind_profile (system_depth (sp), profile_clock ());
+  }
+}
+
+//! @brief Name routine texts after the identifier or operator they are bound to.
+
+static void name_routines (NODE_T * p)
+{
+  for (; p != NO_NODE; FORWARD (p)) {
+    if ((IS (p, DEFINING_IDENTIFIER) || IS (p, DEFINING_OPERATOR)) && NEXT (p) != NO_NODE && NEXT_NEXT (p) != NO_NODE) {
+      NODE_T *u = NEXT_NEXT (p);
+      if (IS (u, UNIT) && SUB (u) != NO_NODE) {
+        u = SUB (u);
+      }
+      if (IS (u, ROUTINE_TEXT) && GINFO (u) != NO_GINFO) {
+        NAME (profile_of (u)) = NSYMBOL (p);
+      }
+    }
+    name_routines (SUB (p));
+  }
+}
+
+//! @brief Discard profile data.
+
+static void free_profile (void)
+{
+  PROFILE_T *z = A68_PROF (records);
+  while (z != NO_PROFILE) {
+    PROFILE_T *next = NEXT (z);
+    PROFILE (GINFO (NODE (z))) = NO_PROFILE;
+    a68_free (z);
+    z = next;
+  }
+  A68_PROF (records) = NO_PROFILE;
+  PROFILE_CONTEXT_T *c = A68_PROF (root);
+  while (c != NO_PROFILE_CONTEXT) {
+// Free depth first without recursion.
+    if (SUB (c) != NO_PROFILE_CONTEXT) {
+      c = SUB (c);
+    } else {
+      PROFILE_CONTEXT_T *up = PARENT (c);
+      if (up != NO_PROFILE_CONTEXT) {
+        SUB (up) = NEXT (c);
+      }
+      a68_free (c);
+      c = up;
+    }
+  }
+  A68_PROF (root) = NO_PROFILE_CONTEXT;
+  if (A68_PROF (stack) != NO_VAR) {
+    a68_free (A68_PROF (stack));
+  }
+  A68_PROF (stack) = NO_VAR;
+  A68_PROF (sp) = A68_PROF (size) = 0;
+}
+
+//! @brief Initialise the profiler.
+
+void genie_init_profile (void)
+{
+  free_profile ();
+  A68_PROF (size) = PROFILE_STACK_SIZE;
+  A68_PROF (stack) = (PROFILE_FRAME_T *) get_heap_space ((size_t) A68_PROF (size) * sizeof (PROFILE_FRAME_T));
+  A68_PROF (root) = new_context (NO_PROFILE_CONTEXT, NO_PROFILE);
+  name_routines (TOP_NODE (&A68_JOB));
+}
+
+//! @brief Name of routine "z" for the report.
+
+static char *routine_name (PROFILE_T * z, char *buf)
+{
+  ASSERT (a68_bufprt (buf, SNPRINTF_SIZE, "%s:%d", (NAME (z) != NO_TEXT ? NAME (z) : "routine"), LINE_NUMBER (NODE (z))) >= 0);
+  return buf;
+}
+
+//! @brief Order routines by descending inclusive time.
+
+static int compare_routines (const void *a, const void *b)
+{
+  PROFILE_T *u = *(PROFILE_T **) a, *v = *(PROFILE_T **) b;
+  return (INCLUSIVE (u) < INCLUSIVE (v) ? 1 : (INCLUSIVE (u) > INCLUSIVE (v) ? -1 : 0));
+}
+
+//! @brief Order units by source position.
+
+static int compare_units (const void *a, const void *b)
+{
+  LINE_T *u = LINE (INFO (NODE (*(PROFILE_T **) a))), *v = LINE (INFO (NODE (*(PROFILE_T **) b)));
+  int k = strcmp (FILENAME (u), FILENAME (v));
+  return (k != 0 ? k : NUMBER (u) - NUMBER (v));
+}
+
+//! @brief Write collapsed stacks under context "c" with path "path".
+
+static void write_stacks (FILE_T f, PROFILE_CONTEXT_T * c, char *path, int len)
+{
+  int n = len;
+  if (ROUTINE (c) != NO_PROFILE) {
+    PROFILE_T *z = ROUTINE (c);
+    int k = -1;
+    if (len < BUFFER_SIZE - 2) {
+      k = a68_bufprt (&path[len], (size_t) (BUFFER_SIZE - len), ";%s:%d", (NAME (z) != NO_TEXT ? NAME (z) : "routine"), LINE_NUMBER (NODE (z)));
+    }
+// Overlong paths are cut at the caller.
+    n = (k > 0 ? len + k : len);
+    path[n] = NULL_CHAR;
+  }
+  UNSIGNED_T usec = (UNSIGNED_T) (1.0e6 * SELF_TIME (c) + 0.5);
+  if (usec > 0) {
+    ASSERT (a68_bufprt (A68 (output_line), SNPRINTF_SIZE, "%.*s %llu\n", PROFILE_TEXT_WIDTH, path, (unsigned long long) usec) >= 0);
+    WRITE (f, A68 (output_line));
+  }
+  for (PROFILE_CONTEXT_T *z = SUB (c); z != NO_PROFILE_CONTEXT; FORWARD (z)) {
+    write_stacks (f, z, path, n);
+  }
+  path[len] = NULL_CHAR;
+}
+
+//! @brief Open report file "name", or warn and give -1.
+
+static FILE_T open_report (char *name)
+{
+// The program has finished; a missing report must not turn that into a failure.
+  FILE_T f = open (name, O_WRONLY | O_CREAT | O_TRUNC, A68_PROTECTION);
+  if (f == -1) {
+    diagnostic (A68_WARNING | A68_FORCE_DIAGNOSTICS, NO_NODE, ERROR_CANNOT_OPEN_NAME, NO_LINE, NO_TEXT, name);
+  }
+  return f;
+}
+
+//! @brief Write the profile by routine and by source line to "f".
+
+static void write_profile (FILE_T f, PROFILE_T ** routines, int n, PROFILE_T ** units, int m)
+{
+  ASSERT (a68_bufprt (A68 (output_line), SNPRINTF_SIZE, "Profile of \"%.*s\"\nTimes are wall-clock milliseconds, heap is bytes allocated\n", PROFILE_TEXT_WIDTH, FILE_SOURCE_NAME (&A68_JOB)) >= 0);
+  WRITE (f, A68 (output_line));
+  WRITE (f, "\nRoutines\n\n       calls    inclusive    exclusive         heap  routine\n");
+  for (int k = 0; k < n; k++) {
+    PROFILE_T *z = routines[k];
+    char buf[SNPRINTF_SIZE];
+    ASSERT (a68_bufprt (A68 (output_line), SNPRINTF_SIZE, "%12llu %12.3f %12.3f %12llu  %.*s\n", (unsigned long long) COUNT (z), 1.0e3 * INCLUSIVE (z), 1.0e3 * EXCLUSIVE (z), (unsigned long long) HEAP (z), PROFILE_TEXT_WIDTH, routine_name (z, buf)) >= 0);
+    WRITE (f, A68 (output_line));
+  }
+  WRITE (f, "\nSource lines\n\n       units    exclusive         heap  line\n");
+  for (int k = 0; k < m;) {
+// Units that start on the same line are summed.
+    LINE_T *l = LINE (INFO (NODE (units[k])));
+    UNSIGNED_T count = 0, heap = 0;
+    REAL_T time = 0;
+    for (; k < m && LINE (INFO (NODE (units[k]))) == l; k++) {
+      count += COUNT (units[k]);
+      heap += HEAP (units[k]);
+      time += EXCLUSIVE (units[k]);
+    }
+    char *src = STRING (l);
+    while (src[0] == BLANK_CHAR || src[0] == TAB_CHAR) {
+      src++;
+    }
+// Long source lines are cut.
+    int len = MIN ((int) strlen (src), PROFILE_TEXT_WIDTH);
+    ASSERT (a68_bufprt (A68 (output_line), SNPRINTF_SIZE, "%12llu %12.3f %12llu %5d  %.*s", (unsigned long long) count, 1.0e3 * time, (unsigned long long) heap, NUMBER (l), len, src) >= 0);
+    WRITE (f, A68 (output_line));
+    if (len == 0 || src[len - 1] != NEWLINE_CHAR) {
+      WRITE (f, NEWLINE_STRING);
+    }
+  }
+}
+
+//! @brief Write the profile and the collapsed stacks.
+
+void genie_profile_report (void)
+{
+  if (A68_PROF (stack) == NO_VAR) {
+    return;
+  }
+// Close frames left open by the end of the program.
+  unwind_profile (0, profile_clock ());
+  int n = 0, m = 0;
+  for (PROFILE_T *z = A68_PROF (records); z != NO_PROFILE; FORWARD (z)) {
+    n++;
+  }
+  PROFILE_T **routines = (PROFILE_T **) get_heap_space ((size_t) (n + 1) * sizeof (PROFILE_T *));
+  PROFILE_T **units = (PROFILE_T **) get_heap_space ((size_t) (n + 1) * sizeof (PROFILE_T *));
+  n = 0;
+  for (PROFILE_T *z = A68_PROF (records); z != NO_PROFILE; FORWARD (z)) {
+    if (COUNT (z) == 0 || LINE_NUMBER (NODE (z)) <= 0) {
+// Skip the standard environment.
+      continue;
+    } else if (IS (NODE (z), ROUTINE_TEXT)) {
+      routines[n++] = z;
+    } else {
+      units[m++] = z;
+    }
+  }
+  qsort (routines, (size_t) n, sizeof (PROFILE_T *), compare_routines);
+  qsort (units, (size_t) m, sizeof (PROFILE_T *), compare_units);
+// Profile by routine and by source line.
+  char *name = new_string (FILE_GENERIC_NAME (&A68_JOB), PROFILE_EXTENSION, NO_TEXT);
+  FILE_T f = open_report (name);
+  if (f != -1) {
+    write_profile (f, routines, n, units, m);
+    ASSERT (close (f) == 0);
+  }
+  a68_free (name);
+// Collapsed stacks for flame graphs, in microseconds.
+  name = new_string (FILE_GENERIC_NAME (&A68_JOB), STACKS_EXTENSION, NO_TEXT);
+  f = open_report (name);
+  if (f != -1) {
+    BUFFER path;
+    a68_bufcpy (path, "main", BUFFER_SIZE);
+    write_stacks (f, A68_PROF (root), path, (int) strlen (path));
+    ASSERT (close (f) == 0);
+  }
+  a68_free (name);
+  a68_free (routines);
+  a68_free (units);
+}
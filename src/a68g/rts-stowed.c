@@ -169,12 +169,12 @@ char *a_to_c_string (NODE_T * p, char *str, A68_REF row)
     GET_DESCRIPTOR (arr, tup, &row);
     int size = ROW_SIZE (tup), n = 0;
     if (size > 0) {
-      BYTE_T *base_address = ADDRESS (&ARRAY (arr));
-      for (int k = LWB (tup); k <= UPB (tup); k++) {
-        int addr = INDEX_1_DIM (arr, tup, k);
-        A68_CHAR *ch = (A68_CHAR *) & (base_address[addr]);
+      BYTE_T *q = &(ADDRESS (&ARRAY (arr))[INDEX_1_DIM (arr, tup, LWB (tup))]);
+      int stride = STRIDE_1_DIM (arr, tup);
+      for (; n < size; n++, q += stride) {
+        A68_CHAR *ch = (A68_CHAR *) q;
         CHECK_INIT (p, INITIALISED (ch), M_CHAR);
-        str[n++] = (char) VALUE (ch);
+        str[n] = (char) VALUE (ch);
       }
     }
     str[n] = NULL_CHAR;
@@ -37,6 +37,30 @@
 // In a table we record opened files.
 // When execution ends, unclosed files are closed, and temps are removed.
 // This keeps /tmp free of spurious files :-)
+// Regular files are read in blocks into a read buffer kept with their entry.
+// Large regular files are mapped instead, and the map is the read buffer.
+
+//! @brief Release the read buffer of a file entry.
+
+static void free_read_buffer (FILE_ENTRY * fe)
+{
+  if (READ_BUFFER (fe) != NO_TEXT) {
+#if defined (BUILD_MMAP)
+    if (IS_MAPPED (fe)) {
+      ASSERT (munmap (READ_BUFFER (fe), MAP_SIZE (fe)) == 0);
+    } else {
+      a68_free (READ_BUFFER (fe));
+    }
+#else
+    a68_free (READ_BUFFER (fe));
+#endif
+    READ_BUFFER (fe) = NO_TEXT;
+  }
+  IS_MAPPED (fe) = A68_FALSE;
+  MAP_SIZE (fe) = 0;
+  READ_INDEX (fe) = 0;
+  READ_SIZE (fe) = 0;
+}
 
 //! @brief Init a file entry.
 
@@ -47,8 +71,10 @@ void init_file_entry (int k)
     POS (fe) = NO_NODE;
     IS_OPEN (fe) = A68_FALSE;
     IS_TMP (fe) = A68_FALSE;
+    IS_REGULAR (fe) = A68_FALSE;
     FD (fe) = A68_NO_FILE;
     IDF (fe) = nil_ref;
+    free_read_buffer (fe);
   }
 }
 
@@ -73,6 +99,9 @@ int store_file_entry (NODE_T * p, FILE_T fd, char *idf, BOOL_T is_tmp)
       IS_OPEN (fe) = A68_TRUE;
       IS_TMP (fe) = is_tmp;
       FD (fe) = fd;
+      struct stat status;
+      IS_REGULAR (fe) = (BOOL_T) (fd != A68_NO_FILE && fstat (fd, &status) == 0 && S_ISREG (ST_MODE (&status)));
+      free_read_buffer (fe);
       IDF (fe) = heap_generator (p, M_C_STRING, len);
       BLOCK_GC_HANDLE (&(IDF (fe)));
       a68_bufcpy (DEREF (char, &IDF (fe)), idf, len);
@@ -92,6 +121,7 @@ void close_file_entry (NODE_T * p, int k)
     FILE_ENTRY *fe = &(A68 (file_entries)[k]);
     if (IS_OPEN (fe)) {
 // Close the file.
+      free_read_buffer (fe);
       if (FD (fe) != A68_NO_FILE && close (FD (fe)) == -1) {
         init_file_entry (k);
         diagnostic (A68_RUNTIME_ERROR, p, ERROR_FILE_CLOSE);
@@ -130,6 +160,20 @@ void free_file_entry (NODE_T * p, int k)
   }
 }
 
+//! @brief Give back to file entry "k" what was read ahead but not scanned.
+
+static void unread_file_entry (int k)
+{
+  if (k >= 0 && k < MAX_OPEN_FILES) {
+    FILE_ENTRY *fe = &(A68 (file_entries)[k]);
+    if (READ_SIZE (fe) > READ_INDEX (fe)) {
+      ASSERT (lseek (FD (fe), -(__off_t) (READ_SIZE (fe) - READ_INDEX (fe)), SEEK_CUR) != -1);
+    }
+    READ_INDEX (fe) = 0;
+    READ_SIZE (fe) = 0;
+  }
+}
+
 //! @brief Close all files and delete all temp files.
 
 void free_file_entries (void)
@@ -287,8 +331,16 @@ void plusto_transput_buffer (NODE_T * p, char ch, int k)
 
 void add_chars_transput_buffer (NODE_T * p, int k, int N, char *ch)
 {
-  for (int j = 0; j < N; j++) {
-    plusab_transput_buffer (p, k, ch[j]);
+  if (N > 0) {
+    int n = get_transput_buffer_index (k);
+    int size = get_transput_buffer_size (k);
+    if (n + N > size - 2) {
+      enlarge_transput_buffer (p, k, MAX (10 * size, n + N + 2));
+    }
+    char *sb = get_transput_buffer (k);
+    MOVE (&sb[n], ch, (unt) N);
+    sb[n + N] = NULL_CHAR;
+    set_transput_buffer_index (k, n + N);
   }
 }
 
@@ -309,14 +361,23 @@ void add_a_string_transput_buffer (NODE_T * p, int k, BYTE_T * ref)
   CHECK_INIT (p, INITIALISED (&row), M_ROWS);
   A68_ARRAY *arr; A68_TUPLE *tup;
   GET_DESCRIPTOR (arr, tup, &row);
-  if (ROW_SIZE (tup) > 0) {
-    BYTE_T *base_address = DEREF (BYTE_T, &ARRAY (arr));
-    for (int i = LWB (tup); i <= UPB (tup); i++) {
-      int addr = INDEX_1_DIM (arr, tup, i);
-      A68_CHAR *ch = (A68_CHAR *) & (base_address[addr]);
+  int len = ROW_SIZE (tup);
+  if (len > 0) {
+// Make room once, then walk the row by its stride.
+    int n = get_transput_buffer_index (k), size = get_transput_buffer_size (k);
+    if (n + len > size - 2) {
+      enlarge_transput_buffer (p, k, MAX (10 * size, n + len + 2));
+    }
+    char *sb = get_transput_buffer (k);
+    BYTE_T *q = &((DEREF (BYTE_T, &ARRAY (arr)))[INDEX_1_DIM (arr, tup, LWB (tup))]);
+    int stride = STRIDE_1_DIM (arr, tup);
+    for (int i = 0; i < len; i++, q += stride) {
+      A68_CHAR *ch = (A68_CHAR *) q;
       CHECK_INIT (p, INITIALISED (ch), M_CHAR);
-      plusab_transput_buffer (p, k, (char) VALUE (ch));
+      sb[n++] = (char) VALUE (ch);
     }
+    sb[n] = NULL_CHAR;
+    set_transput_buffer_index (k, n);
   }
 }
 
@@ -1157,6 +1218,7 @@ void genie_set (NODE_T * p)
     diagnostic (A68_RUNTIME_ERROR, p, ERROR_FILE_RESET);
     exit_genie (p, A68_RUNTIME_ERROR);
   } else {
+    unread_file_entry (FILE_ENTRY (file));
     errno = 0;
     __off_t curpos = lseek (FD (file), 0, SEEK_CUR);
     __off_t maxpos = lseek (FD (file), 0, SEEK_END);
@@ -1431,6 +1493,73 @@ void transput_error (NODE_T * p, A68_REF ref_file, MOID_T * m)
 
 // Implementation of put and get.
 
+#if defined (BUILD_MMAP)
+
+//! @brief Map a large regular file as its read buffer.
+
+static void map_read_buffer (FILE_ENTRY * fe)
+{
+  struct stat status;
+  if (fstat (FD (fe), &status) == 0 && ST_SIZE (&status) > 0 && (size_t) ST_SIZE (&status) >= MMAP_THRESHOLD) {
+    void *map = mmap (NULL, (size_t) ST_SIZE (&status), PROT_READ, MAP_PRIVATE, FD (fe), 0);
+    if (map != MAP_FAILED) {
+      (void) posix_madvise (map, (size_t) ST_SIZE (&status), POSIX_MADV_SEQUENTIAL);
+      READ_BUFFER (fe) = (char *) map;
+      MAP_SIZE (fe) = (size_t) ST_SIZE (&status);
+      IS_MAPPED (fe) = A68_TRUE;
+    }
+  }
+}
+
+//! @brief Read ahead through the map, from the file position to the end of the map.
+
+static BOOL_T scan_mapped_buffer (FILE_ENTRY * fe)
+{
+  __off_t pos = lseek (FD (fe), 0, SEEK_CUR);
+  if (pos >= 0 && (size_t) pos < MAP_SIZE (fe)) {
+    READ_INDEX (fe) = (size_t) pos;
+    READ_SIZE (fe) = MAP_SIZE (fe);
+    ASSERT (lseek (FD (fe), (__off_t) MAP_SIZE (fe), SEEK_SET) != -1);
+    return A68_TRUE;
+  }
+// Past the map, for instance when the file grew; read in blocks from here.
+  free_read_buffer (fe);
+  return A68_FALSE;
+}
+
+#endif
+
+//! @brief Get next char from a regular file through its read buffer.
+
+static int read_buffer_scanner (A68_FILE * f, FILE_ENTRY * fe)
+{
+  if (READ_INDEX (fe) >= READ_SIZE (fe)) {
+#if defined (BUILD_MMAP)
+    if (READ_BUFFER (fe) == NO_TEXT && MAP_SIZE (fe) == 0) {
+      map_read_buffer (fe);
+    }
+    if (IS_MAPPED (fe) && scan_mapped_buffer (fe)) {
+      END_OF_FILE (f) = A68_FALSE;
+      return READ_BUFFER (fe)[READ_INDEX (fe)++];
+    }
+#endif
+    if (READ_BUFFER (fe) == NO_TEXT) {
+      READ_BUFFER (fe) = (char *) a68_alloc ((size_t) READ_BUFFER_SIZE, __func__, __LINE__);
+      ABEND (READ_BUFFER (fe) == NO_TEXT, ERROR_OUT_OF_CORE, __func__);
+    }
+    ssize_t chars_read = io_read_conv (FD (f), READ_BUFFER (fe), (size_t) READ_BUFFER_SIZE);
+    READ_INDEX (fe) = 0;
+    READ_SIZE (fe) = (chars_read > 0 ? (size_t) chars_read : 0);
+  }
+  if (READ_INDEX (fe) < READ_SIZE (fe)) {
+    END_OF_FILE (f) = A68_FALSE;
+    return READ_BUFFER (fe)[READ_INDEX (fe)++];
+  } else {
+    END_OF_FILE (f) = A68_TRUE;
+    return EOF_CHAR;
+  }
+}
+
 //! @brief Get next char from file.
 
 int char_scanner (A68_FILE * f)
@@ -1441,6 +1570,10 @@ int char_scanner (A68_FILE * f)
     return pop_char_transput_buffer (TRANSPUT_BUFFER (f));
   } else if (IS_NIL (STRING (f))) {
 // Fetch next CHAR from the FILE.
+    int k = FILE_ENTRY (f);
+    if (k >= 0 && k < MAX_OPEN_FILES && IS_OPEN (&(A68 (file_entries)[k])) && IS_REGULAR (&(A68 (file_entries)[k]))) {
+      return read_buffer_scanner (f, &(A68 (file_entries)[k]));
+    }
     char ch;
     ssize_t chars_read = io_read_conv (FD (f), &ch, 1);
     if (chars_read == 1) {
@@ -1468,6 +1601,28 @@ int char_scanner (A68_FILE * f)
   }
 }
 
+//! @brief Take from the read buffer a run of characters without line ends or terminators.
+
+int span_char_scanner (A68_FILE * f, char *term, char **run)
+{
+  int k = FILE_ENTRY (f);
+  if (get_transput_buffer_index (TRANSPUT_BUFFER (f)) > 0 || !IS_NIL (STRING (f)) || k < 0 || k >= MAX_OPEN_FILES) {
+    return 0;
+  }
+  FILE_ENTRY *fe = &(A68 (file_entries)[k]);
+  if (!IS_OPEN (fe) || !IS_REGULAR (fe) || READ_INDEX (fe) >= READ_SIZE (fe)) {
+    return 0;
+  }
+  char *z = &(READ_BUFFER (fe)[READ_INDEX (fe)]);
+  size_t avail = MIN (READ_SIZE (fe) - READ_INDEX (fe), (size_t) MEGABYTE), n = 0;
+  while (n < avail && z[n] != EOF_CHAR && !IS_NL_FF (z[n]) && (term == NO_TEXT || strchr (term, z[n]) == NO_TEXT)) {
+    n++;
+  }
+  READ_INDEX (fe) += n;
+  *run = z;
+  return (int) n;
+}
+
 //! @brief Push back look-ahead character to file.
 
 void unchar_scanner (NODE_T * p, A68_FILE * f, char ch)
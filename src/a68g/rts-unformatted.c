@@ -211,6 +211,10 @@ void scan_string (NODE_T * p, char *term, A68_REF ref_file)
         unchar_scanner (p, f, (char) ch);
       } else {
         plusab_transput_buffer (p, INPUT_BUFFER, (char) ch);
+// Take the rest of the run straight from the read buffer.
+        char *run;
+        int n = span_char_scanner (f, term, &run);
+        add_chars_transput_buffer (p, INPUT_BUFFER, n, run);
         ch = char_scanner (f);
       }
     }
@@ -1182,6 +1186,122 @@ void genie_write_file (NODE_T * p)
   }
 }
 
+// Rows of plain values are moved through a staging buffer, in blocks.
+// The file holds the same bytes, in the same order, as with one value at a time.
+
+#define BIN_BLOCK_SIZE ((size_t) (64 * KILOBYTE))
+
+//! @brief Where in an object of plain "mode" the bytes are that binary transput moves.
+
+static BOOL_T bin_plain_mode (MOID_T * mode, size_t * offset, size_t * len, BOOL_T * is_mp)
+{
+  *is_mp = A68_FALSE;
+  if (mode == M_INT) {
+    *offset = offsetof (A68_INT, value);
+    *len = sizeof (VALUE ((A68_INT *) NULL));
+  } else if (mode == M_REAL) {
+    *offset = offsetof (A68_REAL, value);
+    *len = sizeof (VALUE ((A68_REAL *) NULL));
+  } else if (mode == M_BOOL) {
+    *offset = offsetof (A68_BOOL, value);
+    *len = sizeof (VALUE ((A68_BOOL *) NULL));
+  } else if (mode == M_CHAR) {
+    *offset = offsetof (A68_CHAR, value);
+    *len = sizeof (VALUE ((A68_CHAR *) NULL));
+  } else if (mode == M_BITS) {
+    *offset = offsetof (A68_BITS, value);
+    *len = sizeof (VALUE ((A68_BITS *) NULL));
+#if (A68_LEVEL >= 3)
+  } else if (mode == M_LONG_INT) {
+    *offset = offsetof (A68_LONG_INT, value);
+    *len = sizeof (VALUE ((A68_LONG_INT *) NULL));
+  } else if (mode == M_LONG_REAL) {
+    *offset = offsetof (A68_LONG_REAL, value);
+    *len = sizeof (VALUE ((A68_LONG_REAL *) NULL));
+  } else if (mode == M_LONG_BITS) {
+    *offset = offsetof (A68_LONG_BITS, value);
+    *len = sizeof (VALUE ((A68_LONG_BITS *) NULL));
+#else
+  } else if (mode == M_LONG_INT || mode == M_LONG_REAL || mode == M_LONG_BITS) {
+    *offset = 0;
+    *len = (size_t) SIZE (mode);
+    *is_mp = A68_TRUE;
+#endif
+  } else if (mode == M_LONG_LONG_INT || mode == M_LONG_LONG_REAL || mode == M_LONG_LONG_BITS) {
+    *offset = 0;
+    *len = (size_t) SIZE (mode);
+    *is_mp = A68_TRUE;
+  } else {
+    return A68_FALSE;
+  }
+  return (BOOL_T) (*len <= BIN_BLOCK_SIZE);
+}
+
+//! @brief Read a row of plain values in blocks.
+
+static void read_bin_row (A68_ARRAY * arr, A68_TUPLE * tup, A68_FILE * f, size_t offset, size_t len, BOOL_T is_mp)
+{
+  BYTE_T *base_addr = DEREF (BYTE_T, &ARRAY (arr));
+  BYTE_T *block = (BYTE_T *) a68_alloc (BIN_BLOCK_SIZE, __func__, __LINE__);
+  ABEND (block == NO_BYTE, ERROR_OUT_OF_CORE, __func__);
+  size_t per_block = BIN_BLOCK_SIZE / len, avail = 0, used = 0;
+  size_t to_do = (size_t) get_row_size (tup, DIM (arr));
+  BOOL_T done = A68_FALSE;
+  initialise_internal_index (tup, DIM (arr));
+  while (!done) {
+    if (used == avail) {
+// Read no further than the end of the row; a short read leaves the rest as they are.
+      size_t elems = MIN (per_block, to_do);
+      ssize_t n = io_read (FD (f), block, elems * len);
+      ASSERT (n != -1);
+      avail = (size_t) n;
+      used = 0;
+      to_do -= elems;
+    }
+    BYTE_T *elem = &base_addr[ROW_ELEMENT (arr, calculate_internal_index (tup, DIM (arr)))];
+    if (avail - used >= len) {
+      MOVE (&elem[offset], &block[used], (unt) len);
+      used += len;
+    } else {
+      used = avail;
+    }
+    if (is_mp) {
+      MP_STATUS ((MP_T *) elem) = (MP_T) INIT_MASK;
+    } else {
+      STATUS ((A68_INT *) elem) = INIT_MASK;
+    }
+    done = increment_internal_index (tup, DIM (arr));
+  }
+  a68_free (block);
+}
+
+//! @brief Write a row of plain values in blocks.
+
+static void write_bin_row (NODE_T * p, MOID_T * mode, A68_ARRAY * arr, A68_TUPLE * tup, A68_FILE * f, size_t offset, size_t len)
+{
+  BYTE_T *base_addr = DEREF (BYTE_T, &ARRAY (arr));
+  BYTE_T *block = (BYTE_T *) a68_alloc (BIN_BLOCK_SIZE, __func__, __LINE__);
+  ABEND (block == NO_BYTE, ERROR_OUT_OF_CORE, __func__);
+  size_t used = 0;
+  BOOL_T done = A68_FALSE;
+  initialise_internal_index (tup, DIM (arr));
+  while (!done) {
+    BYTE_T *elem = &base_addr[ROW_ELEMENT (arr, calculate_internal_index (tup, DIM (arr)))];
+    genie_check_initialisation (p, elem, mode);
+    if (used + len > BIN_BLOCK_SIZE) {
+      ASSERT (io_write (FD (f), block, used) != -1);
+      used = 0;
+    }
+    MOVE (&block[used], &elem[offset], (unt) len);
+    used += len;
+    done = increment_internal_index (tup, DIM (arr));
+  }
+  if (used > 0) {
+    ASSERT (io_write (FD (f), block, used) != -1);
+  }
+  a68_free (block);
+}
+
 //! @brief Read object binary from file.
 
 void genie_read_bin_standard (NODE_T * p, MOID_T * mode, BYTE_T * item, A68_REF ref_file)
@@ -1290,7 +1410,11 @@ void genie_read_bin_standard (NODE_T * p, MOID_T * mode, BYTE_T * item, A68_REF
     A68_ARRAY *arr; A68_TUPLE *tup;
     CHECK_INIT (p, INITIALISED ((A68_REF *) item), M_ROWS);
     GET_DESCRIPTOR (arr, tup, (A68_REF *) item);
-    if (get_row_size (tup, DIM (arr)) > 0) {
+    size_t offset, len;
+    BOOL_T is_mp;
+    if (get_row_size (tup, DIM (arr)) > 0 && bin_plain_mode (SUB (deflexed), &offset, &len, &is_mp)) {
+      read_bin_row (arr, tup, f, offset, len, is_mp);
+    } else if (get_row_size (tup, DIM (arr)) > 0) {
       BYTE_T *base_addr = DEREF (BYTE_T, &ARRAY (arr));
       BOOL_T done = A68_FALSE;
       initialise_internal_index (tup, DIM (arr));
@@ -1449,7 +1573,11 @@ void genie_write_bin_standard (NODE_T * p, MOID_T * mode, BYTE_T * item, A68_REF
     A68_ARRAY *arr; A68_TUPLE *tup;
     CHECK_INIT (p, INITIALISED ((A68_REF *) item), M_ROWS);
     GET_DESCRIPTOR (arr, tup, (A68_REF *) item);
-    if (get_row_size (tup, DIM (arr)) > 0) {
+    size_t offset, len;
+    BOOL_T is_mp;
+    if (get_row_size (tup, DIM (arr)) > 0 && bin_plain_mode (SUB (deflexed), &offset, &len, &is_mp)) {
+      write_bin_row (p, SUB (deflexed), arr, tup, f, offset, len);
+    } else if (get_row_size (tup, DIM (arr)) > 0) {
       BYTE_T *base_addr = DEREF (BYTE_T, &ARRAY (arr));
       BOOL_T done = A68_FALSE;
       initialise_internal_index (tup, DIM (arr));
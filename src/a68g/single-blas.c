@@ -47,14 +47,28 @@ void a68_dgemm (CBLAS_TRANSPOSE_t TransA, CBLAS_TRANSPOSE_t TransB,
                 double alpha, gsl_matrix *A, gsl_matrix *B,
                 double beta, gsl_matrix **C)
 {
-// Wrapper for gsl_blas_dgemm, allocates result matrix C if needed.
+// Wrapper for torrix_dgemm, allocates result matrix C if needed.
 // GEMM from BLAS computes C := alpha * TransA (A) * TransB (B) + beta * C
   if ((*C) == NO_REAL_MATRIX) {
     unt N = (TransA == SELF ? SIZE1 (A) : SIZE2 (A));
     unt M = (TransB == SELF ? SIZE2 (B) : SIZE1 (B));
     (*C) = gsl_matrix_calloc (N, M); // NxM * MxP gives NxP.
   }
-  ASSERT_GSL (gsl_blas_dgemm (TransA, TransB, alpha, A, B, beta, (*C)))
+// GSL matrices are row-major; a transpose swaps the strides.
+  int ra = (int) TDA (A), ca = 1, rb = (int) TDA (B), cb = 1;
+  int k = (int) (TransA == SELF ? SIZE2 (A) : SIZE1 (A));
+  if (TransA != SELF) {
+    ca = ra;
+    ra = 1;
+  }
+  if (TransB != SELF) {
+    cb = rb;
+    rb = 1;
+  }
+  if (k != (int) (TransB == SELF ? SIZE1 (B) : SIZE2 (B)) || SIZE1 (*C) != (TransA == SELF ? SIZE1 (A) : SIZE2 (A)) || SIZE2 (*C) != (TransB == SELF ? SIZE2 (B) : SIZE1 (B))) {
+    ASSERT_GSL (GSL_EBADLEN);
+  }
+  torrix_dgemm ((int) SIZE1 (*C), (int) SIZE2 (*C), k, alpha, DATA (A), ra, ca, DATA (B), rb, cb, beta, DATA (*C), (int) TDA (*C), 1);
 }
 
 #endif
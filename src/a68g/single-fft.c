@@ -26,6 +26,7 @@
 #include "a68g.h"
 #include "a68g-genie.h"
 #include "a68g-prelude.h"
+#include "a68g-torrix.h"
 
 #if defined (HAVE_GSL)
 
@@ -67,13 +68,9 @@ REAL_T *pop_array_real (NODE_T * p, int *len)
   }
   REAL_T *v = (REAL_T *) get_heap_space (2 * (size_t) (*len) * sizeof (REAL_T));
   fft_test_error (v == NO_REAL ? GSL_ENOMEM : GSL_SUCCESS);
-  BYTE_T *base = DEREF (BYTE_T, &ARRAY (arr));
-  int index = VECTOR_OFFSET (arr, tup);
-  int inc = SPAN (tup) * ELEM_SIZE (arr);
-  for (int k = 0; k < (*len); k++, index += inc) {
-    A68_REAL *x = (A68_REAL *) (base + index);
-    CHECK_INIT (p, INITIALISED (x), M_REAL);
-    v[2 * k] = VALUE (x);
+  BYTE_T *base = DEREF (BYTE_T, &ARRAY (arr)) + VECTOR_OFFSET (arr, tup);
+  torrix_get_block (p, M_REAL, base, SPAN (tup) * ELEM_SIZE (arr), 0, *len, 1, v, 2);
+  for (int k = 0; k < (*len); k++) {
     v[2 * k + 1] = 0.0;
   }
   return v;
@@ -85,15 +82,8 @@ void push_array_real (NODE_T * p, const REAL_T * v, int len)
 {
   A68_REF desc, row; A68_ARRAY arr; A68_TUPLE tup;
   NEW_ROW_1D (desc, row, arr, tup, M_ROW_REAL, M_REAL, len);
-  BYTE_T *base = DEREF (BYTE_T, &ARRAY (&arr));
-  int index = VECTOR_OFFSET (&arr, &tup);
-  int inc = SPAN (&tup) * ELEM_SIZE (&arr);
-  for (int k = 0; k < len; k++, index += inc) {
-    A68_REAL *x = (A68_REAL *) (base + index);
-    STATUS (x) = INIT_MASK;
-    VALUE (x) = v[2 * k];
-    CHECK_REAL (p, VALUE (x));
-  }
+  BYTE_T *base = DEREF (BYTE_T, &ARRAY (&arr)) + VECTOR_OFFSET (&arr, &tup);
+  torrix_put_block (p, M_REAL, v, 2, len, 1, base, SPAN (&tup) * ELEM_SIZE (&arr), 0);
   PUSH_REF (p, desc);
 }
 
@@ -113,17 +103,8 @@ REAL_T *pop_array_complex (NODE_T * p, int *len)
   }
   REAL_T *v = (REAL_T *) get_heap_space (2 * (size_t) (*len) * sizeof (REAL_T));
   fft_test_error (v == NO_REAL ? GSL_ENOMEM : GSL_SUCCESS);
-  BYTE_T *base = DEREF (BYTE_T, &ARRAY (arr));
-  int index = VECTOR_OFFSET (arr, tup);
-  int inc = SPAN (tup) * ELEM_SIZE (arr);
-  for (int k = 0; k < (*len); k++, index += inc) {
-    A68_REAL *re = (A68_REAL *) (base + index);
-    A68_REAL *im = (A68_REAL *) (base + index + SIZE (M_REAL));
-    CHECK_INIT (p, INITIALISED (re), M_COMPLEX);
-    CHECK_INIT (p, INITIALISED (im), M_COMPLEX);
-    v[2 * k] = VALUE (re);
-    v[2 * k + 1] = VALUE (im);
-  }
+  BYTE_T *base = DEREF (BYTE_T, &ARRAY (arr)) + VECTOR_OFFSET (arr, tup);
+  torrix_get_block (p, M_COMPLEX, base, SPAN (tup) * ELEM_SIZE (arr), 0, *len, 1, v, 1);
   return v;
 }
 
@@ -133,18 +114,8 @@ void push_array_complex (NODE_T * p, const REAL_T * v, int len)
 {
   A68_REF desc, row; A68_ARRAY arr; A68_TUPLE tup;
   NEW_ROW_1D (desc, row, arr, tup, M_ROW_COMPLEX, M_COMPLEX, len);
-  BYTE_T *base = DEREF (BYTE_T, &ARRAY (&arr));
-  int index = VECTOR_OFFSET (&arr, &tup);
-  int inc = SPAN (&tup) * ELEM_SIZE (&arr);
-  for (int k = 0; k < len; k++, index += inc) {
-    A68_REAL *re = (A68_REAL *) (base + index);
-    A68_REAL *im = (A68_REAL *) (base + index + SIZE (M_REAL));
-    STATUS (re) = INIT_MASK;
-    VALUE (re) = v[2 * k];
-    STATUS (im) = INIT_MASK;
-    VALUE (im) = v[2 * k + 1];
-    CHECK_COMPLEX (p, VALUE (re), VALUE (im));
-  }
+  BYTE_T *base = DEREF (BYTE_T, &ARRAY (&arr)) + VECTOR_OFFSET (&arr, &tup);
+  torrix_put_block (p, M_COMPLEX, v, 1, len, 1, base, SPAN (&tup) * ELEM_SIZE (&arr), 0);
   PUSH_REF (p, desc);
 }
 
@@ -125,15 +125,8 @@ A68_ROW vector_to_row (NODE_T * p, gsl_vector * v)
   unt len = (unt) (SIZE (v));
   A68_ROW desc, row; A68_ARRAY arr; A68_TUPLE tup;
   NEW_ROW_1D (desc, row, arr, tup, M_ROW_REAL, M_REAL, len);
-  BYTE_T *base = DEREF (BYTE_T, &ARRAY (&arr));
-  int idx = VECTOR_OFFSET (&arr, &tup);
-  unt inc = SPAN (&tup) * ELEM_SIZE (&arr);
-  for (int k = 0; k < len; k++, idx += inc) {
-    A68_REAL *x = (A68_REAL *) (base + idx);
-    STATUS (x) = INIT_MASK;
-    VALUE (x) = gsl_vector_get (v, (size_t) k);
-    CHECK_REAL (p, VALUE (x));
-  }
+  BYTE_T *base = DEREF (BYTE_T, &ARRAY (&arr)) + VECTOR_OFFSET (&arr, &tup);
+  torrix_put_block (p, M_REAL, DATA (v), STRIDE (v), len, 1, base, SPAN (&tup) * ELEM_SIZE (&arr), 0);
   return desc;
 }
 
@@ -155,17 +148,9 @@ A68_ROW matrix_to_row (NODE_T * p, gsl_matrix * a)
   LWB (&tup2) = 1; UPB (&tup2) = len2; SPAN (&tup2) = ROW_SIZE (&tup1);
   SHIFT (&tup2) = LWB (&tup2) * SPAN (&tup2); K (&tup2) = 0;
   PUT_DESCRIPTOR2 (arr, tup1, tup2, &desc);
-  BYTE_T *base = DEREF (BYTE_T, &ARRAY (&arr));
-  int idx1 = MATRIX_OFFSET (&arr, &tup1, &tup2);
+  BYTE_T *base = DEREF (BYTE_T, &ARRAY (&arr)) + MATRIX_OFFSET (&arr, &tup1, &tup2);
   int inc1 = SPAN (&tup1) * ELEM_SIZE (&arr), inc2 = SPAN (&tup2) * ELEM_SIZE (&arr);
-  for (int k1 = 0; k1 < len1; k1++, idx1 += inc1) {
-    for (int k2 = 0, idx2 = idx1; k2 < len2; k2++, idx2 += inc2) {
-      A68_REAL *x = (A68_REAL *) (base + idx2);
-      STATUS (x) = INIT_MASK;
-      VALUE (x) = gsl_matrix_get (a, (size_t) k1, (size_t) k2);
-      CHECK_REAL (p, VALUE (x));
-    }
-  }
+  torrix_put_block (p, M_REAL, DATA (a), TDA (a), len1, len2, base, inc1, inc2);
   return desc;
 }
 
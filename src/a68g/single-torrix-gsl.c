@@ -48,6 +48,69 @@ void torrix_error_handler (const char *reason, const char *file, int line, int g
   exit_genie (A68 (f_entry), A68_RUNTIME_ERROR);
 }
 
+// Conversion between A68 rows and GSL storage.
+// A68 REAL elements carry a status word, so GSL cannot alias a row and the
+// data is copied. A68 rows are column-major and GSL is row-major, so each copy
+// is a transposition; it is done in tiles so that the strided side stays in
+// cache. Element status and finiteness are checked once per block.
+
+#define TORRIX_TILE 32
+
+//! @brief Copy [len1, len2] REAL or COMPLEX row elements into row-major GSL storage.
+
+void torrix_get_block (NODE_T * p, MOID_T * m, BYTE_T * src, int inc1, int inc2, int len1, int len2, REAL_T * dst, size_t tda)
+{
+  int lanes = (m == M_COMPLEX ? 2 : 1), im = SIZE (M_REAL);
+  unt init = INIT_MASK;
+  for (int b2 = 0; b2 < len2; b2 += TORRIX_TILE) {
+    int e2 = MIN (b2 + TORRIX_TILE, len2);
+    for (int b1 = 0; b1 < len1; b1 += TORRIX_TILE) {
+      int e1 = MIN (b1 + TORRIX_TILE, len1);
+      for (int k2 = b2; k2 < e2; k2++) {
+        BYTE_T *u = src + k2 * inc2;
+        for (int k1 = b1; k1 < e1; k1++) {
+          REAL_T *v = &dst[(k1 * tda + k2) * lanes];
+          for (int l = 0; l < lanes; l++) {
+            A68_REAL *x = (A68_REAL *) (u + k1 * inc1 + l * im);
+            init &= STATUS (x);
+            v[l] = VALUE (x);
+          }
+        }
+      }
+    }
+  }
+  CHECK_INIT (p, (init & INIT_MASK) != 0, m);
+}
+
+//! @brief Copy row-major GSL storage into [len1, len2] REAL or COMPLEX row elements.
+
+void torrix_put_block (NODE_T * p, MOID_T * m, const REAL_T * src, size_t tda, int len1, int len2, BYTE_T * dst, int inc1, int inc2)
+{
+// "z - z" is zero unless "z" is infinite or NaN.
+  int lanes = (m == M_COMPLEX ? 2 : 1), im = SIZE (M_REAL);
+  unt bad = 0;
+  for (int b2 = 0; b2 < len2; b2 += TORRIX_TILE) {
+    int e2 = MIN (b2 + TORRIX_TILE, len2);
+    for (int b1 = 0; b1 < len1; b1 += TORRIX_TILE) {
+      int e1 = MIN (b1 + TORRIX_TILE, len1);
+      for (int k2 = b2; k2 < e2; k2++) {
+        BYTE_T *u = dst + k2 * inc2;
+        for (int k1 = b1; k1 < e1; k1++) {
+          const REAL_T *v = &src[(k1 * tda + k2) * lanes];
+          for (int l = 0; l < lanes; l++) {
+            A68_REAL *x = (A68_REAL *) (u + k1 * inc1 + l * im);
+            REAL_T z = v[l];
+            STATUS (x) = INIT_MASK;
+            VALUE (x) = z;
+            bad |= (z - z != 0);
+          }
+        }
+      }
+    }
+  }
+  PRELUDE_ERROR (bad, p, ERROR_INFINITE, m);
+}
+
 //! @brief Pop [] INT on the stack as gsl_permutation.
 
 gsl_permutation *pop_permutation (NODE_T * p, BOOL_T get)
@@ -98,17 +161,12 @@ gsl_vector *pop_vector (NODE_T * p, BOOL_T get)
   CHECK_REF (p, desc, M_ROW_REAL);
   GET_DESCRIPTOR (arr, tup, &desc);
   int len = ROW_SIZE (tup);
-  gsl_vector *v = gsl_vector_calloc ((size_t) len);
-  if (get && len > 0) {
-    BYTE_T *base = DEREF (BYTE_T, &ARRAY (arr));
-    int idx = VECTOR_OFFSET (arr, tup);
-    int inc = SPAN (tup) * ELEM_SIZE (arr);
-    for (int k = 0; k < len; k++, idx += inc) {
-      A68_REAL *x = (A68_REAL *) (base + idx);
-      CHECK_INIT (p, INITIALISED (x), M_REAL);
-      gsl_vector_set (v, (size_t) k, VALUE (x));
-    }
+  if (!get || len == 0) {
+    return gsl_vector_calloc ((size_t) len);
   }
+  gsl_vector *v = gsl_vector_alloc ((size_t) len);
+  BYTE_T *base = DEREF (BYTE_T, &ARRAY (arr)) + VECTOR_OFFSET (arr, tup);
+  torrix_get_block (p, M_REAL, base, SPAN (tup) * ELEM_SIZE (arr), 0, len, 1, DATA (v), STRIDE (v));
   return v;
 }
 
@@ -129,19 +187,13 @@ gsl_matrix *pop_matrix (NODE_T * p, BOOL_T get)
   GET_DESCRIPTOR (arr, tup1, &desc);
   tup2 = &(tup1[1]);
   int len1 = ROW_SIZE (tup1), len2 = ROW_SIZE (tup2);
-  gsl_matrix *a = gsl_matrix_calloc ((size_t) len1, (size_t) len2);
-  if (get && (len1 * len2 > 0)) {
-    BYTE_T *base = DEREF (BYTE_T, &ARRAY (arr));
-    int idx1 = MATRIX_OFFSET (arr, tup1, tup2);
-    int inc1 = SPAN (tup1) * ELEM_SIZE (arr), inc2 = SPAN (tup2) * ELEM_SIZE (arr);
-    for (int k1 = 0; k1 < len1; k1++, idx1 += inc1) {
-      for (int k2 = 0, idx2 = idx1; k2 < len2; k2++, idx2 += inc2) {
-        A68_REAL *x = (A68_REAL *) (base + idx2);
-        CHECK_INIT (p, INITIALISED (x), M_REAL);
-        gsl_matrix_set (a, (size_t) k1, (size_t) k2, VALUE (x));
-      }
-    }
+  if (!get || len1 * len2 == 0) {
+    return gsl_matrix_calloc ((size_t) len1, (size_t) len2);
   }
+  gsl_matrix *a = gsl_matrix_alloc ((size_t) len1, (size_t) len2);
+  BYTE_T *base = DEREF (BYTE_T, &ARRAY (arr)) + MATRIX_OFFSET (arr, tup1, tup2);
+  int inc1 = SPAN (tup1) * ELEM_SIZE (arr), inc2 = SPAN (tup2) * ELEM_SIZE (arr);
+  torrix_get_block (p, M_REAL, base, inc1, inc2, len1, len2, DATA (a), TDA (a));
   return a;
 }
 
@@ -161,21 +213,12 @@ gsl_vector_complex *pop_vector_complex (NODE_T * p, BOOL_T get)
   CHECK_REF (p, desc, M_ROW_COMPLEX);
   GET_DESCRIPTOR (arr, tup, &desc);
   int len = ROW_SIZE (tup);
-  gsl_vector_complex *v = gsl_vector_complex_calloc ((size_t) len);
-  if (get && len > 0) {
-    BYTE_T *base = DEREF (BYTE_T, &ARRAY (arr));
-    int idx = VECTOR_OFFSET (arr, tup);
-    int inc = SPAN (tup) * ELEM_SIZE (arr);
-    for (int k = 0; k < len; k++, idx += inc) {
-      A68_REAL *re = (A68_REAL *) (base + idx);
-      A68_REAL *im = (A68_REAL *) (base + idx + SIZE (M_REAL));
-      gsl_complex z;
-      CHECK_INIT (p, INITIALISED (re), M_COMPLEX);
-      CHECK_INIT (p, INITIALISED (im), M_COMPLEX);
-      GSL_SET_COMPLEX (&z, VALUE (re), VALUE (im));
-      gsl_vector_complex_set (v, (size_t) k, z);
-    }
+  if (!get || len == 0) {
+    return gsl_vector_complex_calloc ((size_t) len);
   }
+  gsl_vector_complex *v = gsl_vector_complex_alloc ((size_t) len);
+  BYTE_T *base = DEREF (BYTE_T, &ARRAY (arr)) + VECTOR_OFFSET (arr, tup);
+  torrix_get_block (p, M_COMPLEX, base, SPAN (tup) * ELEM_SIZE (arr), 0, len, 1, DATA (v), STRIDE (v));
   return v;
 }
 
@@ -186,19 +229,8 @@ void push_vector_complex (NODE_T * p, gsl_vector_complex * v)
   int len = (int) (SIZE (v));
   A68_REF desc, row; A68_ARRAY arr; A68_TUPLE tup;
   NEW_ROW_1D (desc, row, arr, tup, M_ROW_COMPLEX, M_COMPLEX, len);
-  BYTE_T *base = DEREF (BYTE_T, &ARRAY (&arr));
-  int idx = VECTOR_OFFSET (&arr, &tup);
-  int inc = SPAN (&tup) * ELEM_SIZE (&arr);
-  for (int k = 0; k < len; k++, idx += inc) {
-    A68_REAL *re = (A68_REAL *) (base + idx);
-    A68_REAL *im = (A68_REAL *) (base + idx + SIZE (M_REAL));
-    gsl_complex z = gsl_vector_complex_get (v, (size_t) k);
-    STATUS (re) = INIT_MASK;
-    VALUE (re) = GSL_REAL (z);
-    STATUS (im) = INIT_MASK;
-    VALUE (im) = GSL_IMAG (z);
-    CHECK_COMPLEX (p, VALUE (re), VALUE (im));
-  }
+  BYTE_T *base = DEREF (BYTE_T, &ARRAY (&arr)) + VECTOR_OFFSET (&arr, &tup);
+  torrix_put_block (p, M_COMPLEX, DATA (v), STRIDE (v), len, 1, base, SPAN (&tup) * ELEM_SIZE (&arr), 0);
   PUSH_REF (p, desc);
 }
 
@@ -212,23 +244,13 @@ gsl_matrix_complex *pop_matrix_complex (NODE_T * p, BOOL_T get)
   GET_DESCRIPTOR (arr, tup1, &desc);
   tup2 = &(tup1[1]);
   int len1 = ROW_SIZE (tup1), len2 = ROW_SIZE (tup2);
-  gsl_matrix_complex *a = gsl_matrix_complex_calloc ((size_t) len1, (size_t) len2);
-  if (get && (len1 * len2 > 0)) {
-    BYTE_T *base = DEREF (BYTE_T, &ARRAY (arr));
-    int idx1 = MATRIX_OFFSET (arr, tup1, tup2);
-    int inc1 = SPAN (tup1) * ELEM_SIZE (arr), inc2 = SPAN (tup2) * ELEM_SIZE (arr);
-    for (int k1 = 0; k1 < len1; k1++, idx1 += inc1) {
-      for (int k2 = 0, idx2 = idx1; k2 < len2; k2++, idx2 += inc2) {
-        A68_REAL *re = (A68_REAL *) (base + idx2);
-        A68_REAL *im = (A68_REAL *) (base + idx2 + SIZE (M_REAL));
-        CHECK_INIT (p, INITIALISED (re), M_COMPLEX);
-        CHECK_INIT (p, INITIALISED (im), M_COMPLEX);
-        gsl_complex z;
-        GSL_SET_COMPLEX (&z, VALUE (re), VALUE (im));
-        gsl_matrix_complex_set (a, (size_t) k1, (size_t) k2, z);
-      }
-    }
+  if (!get || len1 * len2 == 0) {
+    return gsl_matrix_complex_calloc ((size_t) len1, (size_t) len2);
   }
+  gsl_matrix_complex *a = gsl_matrix_complex_alloc ((size_t) len1, (size_t) len2);
+  BYTE_T *base = DEREF (BYTE_T, &ARRAY (arr)) + MATRIX_OFFSET (arr, tup1, tup2);
+  int inc1 = SPAN (tup1) * ELEM_SIZE (arr), inc2 = SPAN (tup2) * ELEM_SIZE (arr);
+  torrix_get_block (p, M_COMPLEX, base, inc1, inc2, len1, len2, DATA (a), TDA (a));
   return a;
 }
 
@@ -250,21 +272,9 @@ void push_matrix_complex (NODE_T * p, gsl_matrix_complex * a)
   LWB (&tup2) = 1; UPB (&tup2) = len2; SPAN (&tup2) = ROW_SIZE (&tup1);
   SHIFT (&tup2) = LWB (&tup2) * SPAN (&tup2); K (&tup2) = 0;
   PUT_DESCRIPTOR2 (arr, tup1, tup2, &desc);
-  BYTE_T *base = DEREF (BYTE_T, &ARRAY (&arr));
-  int idx1 = MATRIX_OFFSET (&arr, &tup1, &tup2);
+  BYTE_T *base = DEREF (BYTE_T, &ARRAY (&arr)) + MATRIX_OFFSET (&arr, &tup1, &tup2);
   int inc1 = SPAN (&tup1) * ELEM_SIZE (&arr), inc2 = SPAN (&tup2) * ELEM_SIZE (&arr);
-  for (int k1 = 0; k1 < len1; k1++, idx1 += inc1) {
-    for (int k2 = 0, idx2 = idx1; k2 < len2; k2++, idx2 += inc2) {
-      A68_REAL *re = (A68_REAL *) (base + idx2);
-      A68_REAL *im = (A68_REAL *) (base + idx2 + SIZE (M_REAL));
-      gsl_complex z = gsl_matrix_complex_get (a, (size_t) k1, (size_t) k2);
-      STATUS (re) = INIT_MASK;
-      VALUE (re) = GSL_REAL (z);
-      STATUS (im) = INIT_MASK;
-      VALUE (im) = GSL_IMAG (z);
-      CHECK_COMPLEX (p, VALUE (re), VALUE (im));
-    }
-  }
+  torrix_put_block (p, M_COMPLEX, DATA (a), TDA (a), len1, len2, base, inc1, inc2);
   PUSH_REF (p, desc);
 }
 
@@ -360,30 +370,6 @@ void genie_vector_col (NODE_T * p)
   (void) gsl_set_error_handler (save_handler);
 }
 
-//! @brief OP - = ([] REAL) [] REAL
-
-void genie_vector_minus (NODE_T * p)
-{
-  gsl_error_handler_t *save_handler = gsl_set_error_handler (torrix_error_handler);
-  gsl_vector *u = pop_vector (p, A68_TRUE);
-  ASSERT_GSL (gsl_vector_scale (u, -1));
-  push_vector (p, u);
-  gsl_vector_free (u);
-  (void) gsl_set_error_handler (save_handler);
-}
-
-//! @brief OP - = ([, ] REAL) [, ] REAL
-
-void genie_matrix_minus (NODE_T * p)
-{
-  gsl_error_handler_t *save_handler = gsl_set_error_handler (torrix_error_handler);
-  gsl_matrix * a = pop_matrix (p, A68_TRUE);
-  ASSERT_GSL (gsl_matrix_scale (a, -1));
-  push_matrix (p, a);
-  gsl_matrix_free (a);
-  (void) gsl_set_error_handler (save_handler);
-}
-
 //! @brief OP T = ([, ] REAL) [, ] REAL
 
 void genie_matrix_transpose (NODE_T * p)
@@ -552,134 +538,6 @@ void genie_matrix_complex_minus (NODE_T * p)
   (void) gsl_set_error_handler (save_handler);
 }
 
-//! @brief OP + = ([] REAL, [] REAL) [] REAL
-
-void genie_vector_add (NODE_T * p)
-{
-  gsl_error_handler_t *save_handler = gsl_set_error_handler (torrix_error_handler);
-  gsl_vector *v = pop_vector (p, A68_TRUE);
-  gsl_vector *u = pop_vector (p, A68_TRUE);
-  ASSERT_GSL (gsl_vector_add (u, v));
-  push_vector (p, u);
-  gsl_vector_free (u);
-  gsl_vector_free (v);
-  (void) gsl_set_error_handler (save_handler);
-}
-
-//! @brief OP - = ([] REAL, [] REAL) [] REAL
-
-void genie_vector_sub (NODE_T * p)
-{
-  gsl_error_handler_t *save_handler = gsl_set_error_handler (torrix_error_handler);
-  gsl_vector *v = pop_vector (p, A68_TRUE);
-  gsl_vector *u = pop_vector (p, A68_TRUE);
-  ASSERT_GSL (gsl_vector_sub (u, v));
-  push_vector (p, u);
-  gsl_vector_free (u);
-  gsl_vector_free (v);
-  (void) gsl_set_error_handler (save_handler);
-}
-
-//! @brief OP = = ([] REAL, [] REAL) BOOL
-
-void genie_vector_eq (NODE_T * p)
-{
-  gsl_error_handler_t *save_handler = gsl_set_error_handler (torrix_error_handler);
-  gsl_vector *v = pop_vector (p, A68_TRUE);
-  gsl_vector *u = pop_vector (p, A68_TRUE);
-  ASSERT_GSL (gsl_vector_sub (u, v));
-  PUSH_VALUE (p, (BOOL_T) (gsl_vector_isnull (u) ? A68_TRUE : A68_FALSE), A68_BOOL);
-  gsl_vector_free (u);
-  gsl_vector_free (v);
-  (void) gsl_set_error_handler (save_handler);
-}
-
-//! @brief OP /= = ([] REAL, [] REAL) BOOL
-
-void genie_vector_ne (NODE_T * p)
-{
-  genie_vector_eq (p);
-  genie_not_bool (p);
-}
-
-//! @brief OP +:= = (REF [] REAL, [] REAL) REF [] REAL
-
-void genie_vector_plusab (NODE_T * p)
-{
-  op_ab_torrix (p, M_REF_ROW_REAL, M_ROW_REAL, genie_vector_add);
-}
-
-//! @brief OP -:= = (REF [] REAL, [] REAL) REF [] REAL
-
-void genie_vector_minusab (NODE_T * p)
-{
-  op_ab_torrix (p, M_REF_ROW_REAL, M_ROW_REAL, genie_vector_sub);
-}
-
-//! @brief OP + = ([, ] REAL, [, ] REAL) [, ] REAL
-
-void genie_matrix_add (NODE_T * p)
-{
-  gsl_error_handler_t *save_handler = gsl_set_error_handler (torrix_error_handler);
-  gsl_matrix *v = pop_matrix (p, A68_TRUE);
-  gsl_matrix *u = pop_matrix (p, A68_TRUE);
-  ASSERT_GSL (gsl_matrix_add (u, v));
-  push_matrix (p, u);
-  gsl_matrix_free (u);
-  gsl_matrix_free (v);
-  (void) gsl_set_error_handler (save_handler);
-}
-
-//! @brief OP - = ([, ] REAL, [, ] REAL) [, ] REAL
-
-void genie_matrix_sub (NODE_T * p)
-{
-  gsl_error_handler_t *save_handler = gsl_set_error_handler (torrix_error_handler);
-  gsl_matrix *v = pop_matrix (p, A68_TRUE);
-  gsl_matrix *u = pop_matrix (p, A68_TRUE);
-  ASSERT_GSL (gsl_matrix_sub (u, v));
-  push_matrix (p, u);
-  gsl_matrix_free (u);
-  gsl_matrix_free (v);
-  (void) gsl_set_error_handler (save_handler);
-}
-
-//! @brief OP = = ([, ] REAL, [, ] REAL) [, ] BOOL
-
-void genie_matrix_eq (NODE_T * p)
-{
-  gsl_error_handler_t *save_handler = gsl_set_error_handler (torrix_error_handler);
-  gsl_matrix *v = pop_matrix (p, A68_TRUE);
-  gsl_matrix *u = pop_matrix (p, A68_TRUE);
-  ASSERT_GSL (gsl_matrix_sub (u, v));
-  PUSH_VALUE (p, (BOOL_T) (gsl_matrix_isnull (u) ? A68_TRUE : A68_FALSE), A68_BOOL);
-  gsl_matrix_free (u);
-  gsl_matrix_free (v);
-  (void) gsl_set_error_handler (save_handler);
-}
-
-//! @brief OP /= = ([, ] REAL, [, ] REAL) [, ] BOOL
-
-void genie_matrix_ne (NODE_T * p)
-{
-  genie_matrix_eq (p);
-  genie_not_bool (p);
-}
-
-//! @brief OP +:= = (REF [, ] REAL, [, ] REAL) [, ] REAL
-
-void genie_matrix_plusab (NODE_T * p)
-{
-  op_ab_torrix (p, M_REF_ROW_ROW_REAL, M_ROW_ROW_REAL, genie_matrix_add);
-}
-
-//! @brief OP -:= = (REF [, ] REAL, [, ] REAL) [, ] REAL
-
-void genie_matrix_minusab (NODE_T * p)
-{
-  op_ab_torrix (p, M_REF_ROW_ROW_REAL, M_ROW_ROW_REAL, genie_matrix_sub);
-}
-
 //! @brief OP + = ([] COMPLEX, [] COMPLEX) [] COMPLEX
 
 void genie_vector_complex_add (NODE_T * p)
@@ -814,62 +672,6 @@ void genie_matrix_complex_minusab (NODE_T * p)
   op_ab_torrix (p, M_REF_ROW_ROW_COMPLEX, M_ROW_ROW_COMPLEX, genie_matrix_complex_sub);
 }
 
-//! @brief OP * = ([] REAL, REAL) [] REAL
-
-void genie_vector_scale_real (NODE_T * p)
-{
-  gsl_error_handler_t *save_handler = gsl_set_error_handler (torrix_error_handler);
-  A68_REAL v;
-  POP_OBJECT (p, &v, A68_REAL);
-  gsl_vector *u = pop_vector (p, A68_TRUE);
-  ASSERT_GSL (gsl_vector_scale (u, VALUE (&v)));
-  push_vector (p, u);
-  gsl_vector_free (u);
-  (void) gsl_set_error_handler (save_handler);
-}
-
-//! @brief OP * = (REAL, [] REAL) [] REAL
-
-void genie_real_scale_vector (NODE_T * p)
-{
-  gsl_error_handler_t *save_handler = gsl_set_error_handler (torrix_error_handler);
-  gsl_vector *u = pop_vector (p, A68_TRUE);
-  A68_REAL v;
-  POP_OBJECT (p, &v, A68_REAL);
-  ASSERT_GSL (gsl_vector_scale (u, VALUE (&v)));
-  push_vector (p, u);
-  gsl_vector_free (u);
-  (void) gsl_set_error_handler (save_handler);
-}
-
-//! @brief OP * = ([, ] REAL, REAL) [, ] REAL
-
-void genie_matrix_scale_real (NODE_T * p)
-{
-  gsl_error_handler_t *save_handler = gsl_set_error_handler (torrix_error_handler);
-  A68_REAL v;
-  POP_OBJECT (p, &v, A68_REAL);
-  gsl_matrix *u = pop_matrix (p, A68_TRUE);
-  ASSERT_GSL (gsl_matrix_scale (u, VALUE (&v)));
-  push_matrix (p, u);
-  gsl_matrix_free (u);
-  (void) gsl_set_error_handler (save_handler);
-}
-
-//! @brief OP * = (REAL, [, ] REAL) [, ] REAL
-
-void genie_real_scale_matrix (NODE_T * p)
-{
-  gsl_error_handler_t *save_handler = gsl_set_error_handler (torrix_error_handler);
-  gsl_matrix *u = pop_matrix (p, A68_TRUE);
-  A68_REAL v;
-  POP_OBJECT (p, &v, A68_REAL);
-  ASSERT_GSL (gsl_matrix_scale (u, VALUE (&v)));
-  push_matrix (p, u);
-  gsl_matrix_free (u);
-  (void) gsl_set_error_handler (save_handler);
-}
-
 //! @brief OP * = ([] COMPLEX, COMPLEX) [] COMPLEX
 
 void genie_vector_complex_scale_complex (NODE_T * p)
@@ -934,20 +736,6 @@ void genie_complex_scale_matrix_complex (NODE_T * p)
   (void) gsl_set_error_handler (save_handler);
 }
 
-//! @brief OP *:= (REF [] REAL, REAL) REF [] REAL
-
-void genie_vector_scale_real_ab (NODE_T * p)
-{
-  op_ab_torrix (p, M_REF_ROW_REAL, M_REAL, genie_vector_scale_real);
-}
-
-//! @brief OP *:= (REF [, ] REAL, REAL) REF [, ] REAL
-
-void genie_matrix_scale_real_ab (NODE_T * p)
-{
-  op_ab_torrix (p, M_REF_ROW_ROW_REAL, M_REAL, genie_matrix_scale_real);
-}
-
 //! @brief OP *:= (REF [] COMPLEX, COMPLEX) REF [] COMPLEX
 
 void genie_vector_complex_scale_complex_ab (NODE_T * p)
@@ -962,42 +750,6 @@ void genie_matrix_complex_scale_complex_ab (NODE_T * p)
   op_ab_torrix (p, M_REF_ROW_ROW_COMPLEX, M_COMPLEX, genie_matrix_complex_scale_complex);
 }
 
-//! @brief OP / = ([] REAL, REAL) [] REAL
-
-void genie_vector_div_real (NODE_T * p)
-{
-  gsl_error_handler_t *save_handler = gsl_set_error_handler (torrix_error_handler);
-  A68_REAL v;
-  POP_OBJECT (p, &v, A68_REAL);
-  if (VALUE (&v) == 0.0) {
-    diagnostic (A68_RUNTIME_ERROR, p, ERROR_DIVISION_BY_ZERO, M_ROW_REAL);
-    exit_genie (p, A68_RUNTIME_ERROR);
-  }
-  gsl_vector *u = pop_vector (p, A68_TRUE);
-  ASSERT_GSL (gsl_vector_scale (u, 1.0 / VALUE (&v)));
-  push_vector (p, u);
-  gsl_vector_free (u);
-  (void) gsl_set_error_handler (save_handler);
-}
-
-//! @brief OP / = ([, ] REAL, REAL) [, ] REAL
-
-void genie_matrix_div_real (NODE_T * p)
-{
-  gsl_error_handler_t *save_handler = gsl_set_error_handler (torrix_error_handler);
-  A68_REAL v;
-  POP_OBJECT (p, &v, A68_REAL);
-  if (VALUE (&v) == 0.0) {
-    diagnostic (A68_RUNTIME_ERROR, p, ERROR_DIVISION_BY_ZERO, M_ROW_ROW_REAL);
-    exit_genie (p, A68_RUNTIME_ERROR);
-  }
-  gsl_matrix *u = pop_matrix (p, A68_TRUE);
-  ASSERT_GSL (gsl_matrix_scale (u, 1.0 / VALUE (&v)));
-  push_matrix (p, u);
-  gsl_matrix_free (u);
-  (void) gsl_set_error_handler (save_handler);
-}
-
 //! @brief OP / = ([] COMPLEX, COMPLEX) [] COMPLEX
 
 void genie_vector_complex_div_complex (NODE_T * p)
@@ -1040,20 +792,6 @@ void genie_matrix_complex_div_complex (NODE_T * p)
   (void) gsl_set_error_handler (save_handler);
 }
 
-//! @brief OP /:= (REF [] REAL, REAL) REF [] REAL
-
-void genie_vector_div_real_ab (NODE_T * p)
-{
-  op_ab_torrix (p, M_REF_ROW_REAL, M_REAL, genie_vector_div_real);
-}
-
-//! @brief OP /:= (REF [, ] REAL, REAL) REF [, ] REAL
-
-void genie_matrix_div_real_ab (NODE_T * p)
-{
-  op_ab_torrix (p, M_REF_ROW_ROW_REAL, M_REAL, genie_matrix_div_real);
-}
-
 //! @brief OP /:= (REF [] COMPLEX, COMPLEX) REF [] COMPLEX
 
 void genie_vector_complex_div_complex_ab (NODE_T * p)
@@ -1068,21 +806,6 @@ void genie_matrix_complex_div_complex_ab (NODE_T * p)
   op_ab_torrix (p, M_REF_ROW_ROW_COMPLEX, M_COMPLEX, genie_matrix_complex_div_complex);
 }
 
-//! @brief OP * = ([] REAL, [] REAL) REAL
-
-void genie_vector_dot (NODE_T * p)
-{
-  gsl_error_handler_t *save_handler = gsl_set_error_handler (torrix_error_handler);
-  gsl_vector *v = pop_vector (p, A68_TRUE);
-  gsl_vector *u = pop_vector (p, A68_TRUE);
-  REAL_T w;
-  ASSERT_GSL (gsl_blas_ddot (u, v, &w));
-  PUSH_VALUE (p, w, A68_REAL);
-  gsl_vector_free (u);
-  gsl_vector_free (v);
-  (void) gsl_set_error_handler (save_handler);
-}
-
 //! @brief OP * = ([] COMPLEX, [] COMPLEX) COMPLEX
 
 void genie_vector_complex_dot (NODE_T * p)
@@ -1204,23 +927,6 @@ void genie_vector_times_matrix (NODE_T * p)
   (void) gsl_set_error_handler (save_handler);
 }
 
-//! @brief OP * = ([, ] REAL, [, ] REAL) [, ] REAL
-
-void genie_matrix_times_matrix (NODE_T * p)
-{
-  gsl_error_handler_t *save_handler = gsl_set_error_handler (torrix_error_handler);
-  gsl_matrix *v = pop_matrix (p, A68_TRUE);
-  gsl_matrix *u = pop_matrix (p, A68_TRUE);
-  int len2 = (int) (SIZE2 (v)), len1 = (int) (SIZE1 (u));
-  gsl_matrix *w = gsl_matrix_calloc ((size_t) len1, (size_t) len2);
-  ASSERT_GSL (gsl_blas_dgemm (CblasNoTrans, CblasNoTrans, 1.0, u, v, 0.0, w));
-  push_matrix (p, w);
-  gsl_matrix_free (u);
-  gsl_matrix_free (v);
-  gsl_matrix_free (w);
-  (void) gsl_set_error_handler (save_handler);
-}
-
 //! @brief OP * = ([, ] COMPLEX, [] COMPLEX) [] COMPLEX
 
 void genie_matrix_complex_times_vector (NODE_T * p)
@@ -1262,24 +968,4 @@ void genie_vector_complex_times_matrix (NODE_T * p)
   (void) gsl_set_error_handler (save_handler);
 }
 
-//! @brief OP * = ([, ] COMPLEX, [, ] COMPLEX) [, ] COMPLEX
-
-void genie_matrix_complex_times_matrix (NODE_T * p)
-{
-  gsl_error_handler_t *save_handler = gsl_set_error_handler (torrix_error_handler);
-  gsl_complex zero, one;
-  GSL_SET_COMPLEX (&zero, 0.0, 0.0);
-  GSL_SET_COMPLEX (&one, 1.0, 0.0);
-  gsl_matrix_complex *v = pop_matrix_complex (p, A68_TRUE);
-  gsl_matrix_complex *u = pop_matrix_complex (p, A68_TRUE);
-  int len1 = (int) (SIZE2 (v)), len2 = (int) (SIZE1 (u));
-  gsl_matrix_complex *w = gsl_matrix_complex_calloc ((size_t) len1, (size_t) len2);
-  ASSERT_GSL (gsl_blas_zgemm (CblasNoTrans, CblasNoTrans, one, u, v, zero, w));
-  gsl_matrix_complex_free (u);
-  gsl_matrix_complex_free (v);
-  push_matrix_complex (p, w);
-  gsl_matrix_complex_free (w);
-  (void) gsl_set_error_handler (save_handler);
-}
-
 #endif
@@ -257,3 +257,985 @@ PROP_T genie_column_function (NODE_T * p)
   SOURCE (&self) = p;
   return self;
 }
+
+// Elementwise operators on [] REAL, [, ] REAL and [] INT.
+// These run on the row storage itself instead of on a GSL copy. Lines of
+// packed elements get an indexed loop that the compiler can unroll and
+// vectorise; other lines are walked with byte strides. Operand status,
+// finiteness and overflow are accumulated in the loops and checked once.
+
+#define TORRIX_ADD 1
+#define TORRIX_SUB 2
+#define TORRIX_MUL 3
+#define TORRIX_DIV 4
+#define TORRIX_NEG 5
+
+typedef struct ROW_VIEW_T ROW_VIEW_T;
+
+struct ROW_VIEW_T
+{
+  BYTE_T *base;
+  int len1, len2, inc1, inc2;
+};
+
+//! @brief Describe the elements of a one or two-dimensional row.
+
+static void row_view (NODE_T * p, A68_ROW * row, MOID_T * m, ROW_VIEW_T * v)
+{
+  CHECK_INIT (p, INITIALISED (row), m);
+  A68_ARRAY *arr; A68_TUPLE *tup;
+  GET_DESCRIPTOR (arr, tup, row);
+  v->len1 = ROW_SIZE (tup);
+  v->inc1 = SPAN (tup) * ELEM_SIZE (arr);
+  if (DIM (arr) == 2) {
+    v->len2 = ROW_SIZE (&tup[1]);
+    v->inc2 = SPAN (&tup[1]) * ELEM_SIZE (arr);
+  } else {
+    v->len2 = 1;
+    v->inc2 = 0;
+  }
+  if (v->len1 > 0 && v->len2 > 0) {
+    int idx = (DIM (arr) == 2 ? MATRIX_OFFSET (arr, tup, &tup[1]) : VECTOR_OFFSET (arr, tup));
+    v->base = &(DEREF (BYTE_T, &ARRAY (arr))[idx]);
+  } else {
+    v->base = NO_BYTE;
+  }
+}
+
+//! @brief Check that two rows have the same shape.
+
+static void row_view_conform (NODE_T * p, ROW_VIEW_T * u, ROW_VIEW_T * v)
+{
+  if (u->len1 != v->len1 || u->len2 != v->len2) {
+    diagnostic (A68_RUNTIME_ERROR, p, ERROR_DIFFERENT_BOUNDS);
+    exit_genie (p, A68_RUNTIME_ERROR);
+  }
+}
+
+//! @brief Make a new row shaped like "v" and describe it.
+
+static A68_ROW row_view_new (NODE_T * p, MOID_T * m, MOID_T * e, ROW_VIEW_T * v, ROW_VIEW_T * z)
+{
+  A68_ROW desc; A68_ARRAY arr; A68_TUPLE tup1, tup2;
+  int dim = (m == M_ROW_ROW_REAL || m == M_ROW_ROW_COMPLEX ? 2 : 1);
+  desc = heap_generator (p, m, DESCRIPTOR_SIZE (dim));
+  DIM (&arr) = dim;
+  MOID (&arr) = e;
+  ELEM_SIZE (&arr) = SIZE (e);
+  SLICE_OFFSET (&arr) = FIELD_OFFSET (&arr) = 0;
+  ARRAY (&arr) = heap_generator_3 (p, m, v->len1, v->len2, SIZE (e));
+  LWB (&tup1) = 1; UPB (&tup1) = v->len1; SPAN (&tup1) = 1;
+  SHIFT (&tup1) = LWB (&tup1); K (&tup1) = 0;
+  if (dim == 1) {
+    PUT_DESCRIPTOR (arr, tup1, &desc);
+  } else {
+    LWB (&tup2) = 1; UPB (&tup2) = v->len2; SPAN (&tup2) = ROW_SIZE (&tup1);
+    SHIFT (&tup2) = LWB (&tup2) * SPAN (&tup2); K (&tup2) = 0;
+    PUT_DESCRIPTOR2 (arr, tup1, tup2, &desc);
+  }
+  z->len1 = v->len1;
+  z->len2 = v->len2;
+  z->inc1 = SIZE (e);
+  z->inc2 = (dim == 2 ? v->len1 * SIZE (e) : 0);
+  z->base = (v->len1 > 0 && v->len2 > 0 ? DEREF (BYTE_T, &ARRAY (&arr)) : NO_BYTE);
+  return desc;
+}
+
+//! @brief Let the first dimension of all views be the one "z" is packed in.
+
+static void row_view_orient (ROW_VIEW_T * z, ROW_VIEW_T * x, ROW_VIEW_T * y)
+{
+  if (z->len2 > 1 && ABS (z->inc2) < ABS (z->inc1)) {
+    ROW_VIEW_T *w[3] = {z, x, y};
+    for (int k = 0; k < 3; k++) {
+      int len = w[k]->len1, inc = w[k]->inc1;
+      w[k]->len1 = w[k]->len2;
+      w[k]->inc1 = w[k]->inc2;
+      w[k]->len2 = len;
+      w[k]->inc2 = inc;
+    }
+  }
+}
+
+// Execute "stmt" for "len" elements of mode T at "z", "x" and "y", that
+// are "iz", "ix" and "iy" bytes apart.
+
+#define ROW_LINE(T, stmt) {\
+  if (iz == (int) sizeof (T) && ix == iz && iy == iz) {\
+    T *z_ = (T *) z, *x_ = (T *) x, *y_ = (T *) y;\
+    for (int k = 0; k < len; k++) {\
+      T *u = &z_[k], *v = &x_[k], *w = &y_[k];\
+      stmt;\
+    }\
+  } else {\
+    for (int k = 0; k < len; k++) {\
+      T *u = (T *) (z + k * iz), *v = (T *) (x + k * ix), *w = (T *) (y + k * iy);\
+      stmt;\
+    }\
+  }}
+
+//! @brief z := x + y, x - y, x * c, x / c or -x for one line of REAL.
+
+static unt real_line (int op, REAL_T c, BYTE_T * z, int iz, BYTE_T * x, int ix, BYTE_T * y, int iy, int len, BOOL_T * finite)
+{
+// Monadic operators pass y = x. "r - r" is zero unless "r" is infinite
+// or not a number.
+  unt init = INIT_MASK, bad = 0;
+  switch (op) {
+  case TORRIX_ADD: {
+      ROW_LINE (A68_REAL, {
+        init &= STATUS (v) & STATUS (w);
+        REAL_T r = VALUE (v) + VALUE (w);
+        bad |= (r - r != 0);
+        STATUS (u) = INIT_MASK;
+        VALUE (u) = r;
+      });
+      break;
+    }
+  case TORRIX_SUB: {
+      ROW_LINE (A68_REAL, {
+        init &= STATUS (v) & STATUS (w);
+        REAL_T r = VALUE (v) - VALUE (w);
+        bad |= (r - r != 0);
+        STATUS (u) = INIT_MASK;
+        VALUE (u) = r;
+      });
+      break;
+    }
+  case TORRIX_MUL: {
+      ROW_LINE (A68_REAL, {
+        init &= STATUS (v) & STATUS (w);
+        REAL_T r = VALUE (v) * c;
+        bad |= (r - r != 0);
+        STATUS (u) = INIT_MASK;
+        VALUE (u) = r;
+      });
+      break;
+    }
+  case TORRIX_NEG: {
+      ROW_LINE (A68_REAL, {
+        init &= STATUS (v) & STATUS (w);
+        STATUS (u) = INIT_MASK;
+        VALUE (u) = -VALUE (v);
+      });
+      break;
+    }
+  case TORRIX_DIV: {
+      ROW_LINE (A68_REAL, {
+        init &= STATUS (v) & STATUS (w);
+        REAL_T r = VALUE (v) / c;
+        bad |= (r - r != 0);
+        STATUS (u) = INIT_MASK;
+        VALUE (u) = r;
+      });
+      break;
+    }
+  }
+  if (bad) {
+    *finite = A68_FALSE;
+  }
+  return init;
+}
+
+//! @brief z := x + y, x - y or -x for one line of INT.
+
+static unt int_line (int op, BYTE_T * z, int iz, BYTE_T * x, int ix, BYTE_T * y, int iy, int len, BOOL_T * valid)
+{
+// Monadic operators pass y = x. Results wrap around; a wrapped sum has a
+// sign unlike both of its operands.
+  INT_T max = A68_MAX_INT;
+  unt init = INIT_MASK, bad = 0;
+  switch (op) {
+  case TORRIX_ADD: {
+      ROW_LINE (A68_INT, {
+        init &= STATUS (v) & STATUS (w);
+        INT_T r = (INT_T) ((UNSIGNED_T) VALUE (v) + (UNSIGNED_T) VALUE (w));
+        bad |= ((((VALUE (v) ^ r) & (VALUE (w) ^ r)) < 0) | (r < -max) | (r > max));
+        STATUS (u) = INIT_MASK;
+        VALUE (u) = r;
+      });
+      break;
+    }
+  case TORRIX_SUB: {
+      ROW_LINE (A68_INT, {
+        init &= STATUS (v) & STATUS (w);
+        INT_T r = (INT_T) ((UNSIGNED_T) VALUE (v) - (UNSIGNED_T) VALUE (w));
+        bad |= ((((VALUE (v) ^ VALUE (w)) & (VALUE (v) ^ r)) < 0) | (r < -max) | (r > max));
+        STATUS (u) = INIT_MASK;
+        VALUE (u) = r;
+      });
+      break;
+    }
+  case TORRIX_NEG: {
+      ROW_LINE (A68_INT, {
+        init &= STATUS (v) & STATUS (w);
+        INT_T r = (INT_T) (- (UNSIGNED_T) VALUE (v));
+        bad |= ((r < -max) | (r > max));
+        STATUS (u) = INIT_MASK;
+        VALUE (u) = r;
+      });
+      break;
+    }
+  }
+  if (bad) {
+    *valid = A68_FALSE;
+  }
+  return init;
+}
+
+//! @brief z := x op y over whole rows.
+
+static void row_kernel (NODE_T * p, MOID_T * m, int op, REAL_T c, ROW_VIEW_T * z, ROW_VIEW_T * x, ROW_VIEW_T * y)
+{
+  BYTE_T *bz = z->base, *bx = x->base, *by = y->base;
+  unt init = INIT_MASK;
+  BOOL_T valid = A68_TRUE;
+  for (int j = 0; j < z->len2; j++, bz += z->inc2, bx += x->inc2, by += y->inc2) {
+    if (m == M_INT) {
+      init &= int_line (op, bz, z->inc1, bx, x->inc1, by, y->inc1, z->len1, &valid);
+    } else {
+      init &= real_line (op, c, bz, z->inc1, bx, x->inc1, by, y->inc1, z->len1, &valid);
+    }
+  }
+  CHECK_INIT (p, init & INIT_MASK, m);
+  if (m == M_INT) {
+    MATH_RTE (p, !valid, M_INT, "M overflow");
+  } else {
+    PRELUDE_ERROR (!valid, p, ERROR_INFINITE, M_REAL);
+  }
+}
+
+//! @brief Copy of "v" when it shares storage with "z" in another way.
+
+static void row_view_unalias (NODE_T * p, MOID_T * m, MOID_T * e, ROW_VIEW_T * z, ROW_VIEW_T * v)
+{
+  if (v->base == NO_BYTE || (v->base == z->base && v->inc1 == z->inc1 && v->inc2 == z->inc2)) {
+    return;
+  }
+  BYTE_T *lo_z = z->base, *hi_z = z->base, *lo_v = v->base, *hi_v = v->base;
+  lo_z += MIN (0, (z->len1 - 1) * z->inc1) + MIN (0, (z->len2 - 1) * z->inc2);
+  hi_z += MAX (0, (z->len1 - 1) * z->inc1) + MAX (0, (z->len2 - 1) * z->inc2) + SIZE (e);
+  lo_v += MIN (0, (v->len1 - 1) * v->inc1) + MIN (0, (v->len2 - 1) * v->inc2);
+  hi_v += MAX (0, (v->len1 - 1) * v->inc1) + MAX (0, (v->len2 - 1) * v->inc2) + SIZE (e);
+  if (hi_v <= lo_z || hi_z <= lo_v) {
+    return;
+  }
+// Overlap; make a packed copy.
+  ROW_VIEW_T w;
+  (void) row_view_new (p, m, e, v, &w);
+  BYTE_T *src = v->base, *dst = w.base;
+  for (int j = 0; j < v->len2; j++, src += v->inc2, dst += w.inc2) {
+    for (int k = 0; k < v->len1; k++) {
+      MOVE (&dst[k * w.inc1], &src[k * v->inc1], SIZE (e));
+    }
+  }
+  *v = w;
+}
+
+//! @brief Monadic or dyadic row operator yielding a new row.
+
+static void row_operator (NODE_T * p, MOID_T * m, MOID_T * e, int op, BOOL_T dyadic, REAL_T c)
+{
+  A68_ROW u, v;
+  ROW_VIEW_T x, y, z;
+  if (dyadic) {
+    POP_REF (p, &v);
+    POP_REF (p, &u);
+    row_view (p, &u, m, &x);
+    row_view (p, &v, m, &y);
+    row_view_conform (p, &x, &y);
+  } else {
+    POP_REF (p, &u);
+    row_view (p, &u, m, &x);
+    y = x;
+  }
+  A68_ROW desc = row_view_new (p, m, e, &x, &z);
+  if (z.base != NO_BYTE) {
+    row_kernel (p, e, op, c, &z, &x, &y);
+  }
+  PUSH_REF (p, desc);
+}
+
+//! @brief Row assigning operator (+:=, -:=, ...) working in place.
+
+static void row_operator_ab (NODE_T * p, MOID_T * m, MOID_T * e, int op, REAL_T c)
+{
+  A68_REF dst;
+  A68_ROW v;
+  ROW_VIEW_T x, y, z;
+  if (op == TORRIX_MUL || op == TORRIX_DIV) {
+    POP_REF (p, &dst);
+  } else {
+    POP_REF (p, &v);
+    POP_REF (p, &dst);
+  }
+  CHECK_REF (p, dst, m);
+  row_view (p, DEREF (A68_ROW, &dst), SUB (m), &z);
+  if (op == TORRIX_MUL || op == TORRIX_DIV) {
+    y = z;
+  } else {
+    row_view (p, &v, SUB (m), &y);
+    row_view_conform (p, &z, &y);
+    row_view_unalias (p, SUB (m), e, &z, &y);
+  }
+  x = z;
+  if (z.base != NO_BYTE) {
+    row_view_orient (&z, &x, &y);
+    row_kernel (p, e, op, c, &z, &x, &y);
+  }
+  PUSH_REF (p, dst);
+}
+
+//! @brief Scalar operand of a scaling operator.
+
+static REAL_T pop_scale (NODE_T * p, MOID_T * m, int op)
+{
+  A68_REAL c;
+  POP_OBJECT (p, &c, A68_REAL);
+  if (op == TORRIX_DIV && VALUE (&c) == 0.0) {
+    diagnostic (A68_RUNTIME_ERROR, p, ERROR_DIVISION_BY_ZERO, m);
+    exit_genie (p, A68_RUNTIME_ERROR);
+  }
+  return VALUE (&c);
+}
+
+//! @brief Whether two rows of REAL or INT hold equal values.
+
+static BOOL_T row_equal (NODE_T * p, MOID_T * m, MOID_T * e)
+{
+  A68_ROW u, v;
+  ROW_VIEW_T x, y;
+  POP_REF (p, &v);
+  POP_REF (p, &u);
+  row_view (p, &u, m, &x);
+  row_view (p, &v, m, &y);
+  row_view_conform (p, &x, &y);
+  if (x.base == NO_BYTE) {
+    return A68_TRUE;
+  }
+  BYTE_T *bx = x.base, *by = y.base;
+  unt init = INIT_MASK, diff = 0;
+  for (int j = 0; j < x.len2; j++, bx += x.inc2, by += y.inc2) {
+    BYTE_T *z = bx, *w = by;
+    for (int k = 0; k < x.len1; k++, z += x.inc1, w += y.inc1) {
+      if (e == M_INT) {
+        init &= STATUS ((A68_INT *) z) & STATUS ((A68_INT *) w);
+        diff |= (VALUE ((A68_INT *) z) != VALUE ((A68_INT *) w));
+      } else {
+        init &= STATUS ((A68_REAL *) z) & STATUS ((A68_REAL *) w);
+        diff |= (VALUE ((A68_REAL *) z) != VALUE ((A68_REAL *) w));
+      }
+    }
+  }
+  CHECK_INIT (p, init & INIT_MASK, e);
+  return (BOOL_T) (diff == 0);
+}
+
+//! @brief OP - = ([] REAL) [] REAL
+
+void genie_vector_minus (NODE_T * p)
+{
+  row_operator (p, M_ROW_REAL, M_REAL, TORRIX_NEG, A68_FALSE, 0.0);
+}
+
+//! @brief OP - = ([, ] REAL) [, ] REAL
+
+void genie_matrix_minus (NODE_T * p)
+{
+  row_operator (p, M_ROW_ROW_REAL, M_REAL, TORRIX_NEG, A68_FALSE, 0.0);
+}
+
+//! @brief OP + = ([] REAL, [] REAL) [] REAL
+
+void genie_vector_add (NODE_T * p)
+{
+  row_operator (p, M_ROW_REAL, M_REAL, TORRIX_ADD, A68_TRUE, 0.0);
+}
+
+//! @brief OP - = ([] REAL, [] REAL) [] REAL
+
+void genie_vector_sub (NODE_T * p)
+{
+  row_operator (p, M_ROW_REAL, M_REAL, TORRIX_SUB, A68_TRUE, 0.0);
+}
+
+//! @brief OP = = ([] REAL, [] REAL) BOOL
+
+void genie_vector_eq (NODE_T * p)
+{
+  BOOL_T eq = row_equal (p, M_ROW_REAL, M_REAL);
+  PUSH_VALUE (p, eq, A68_BOOL);
+}
+
+//! @brief OP /= = ([] REAL, [] REAL) BOOL
+
+void genie_vector_ne (NODE_T * p)
+{
+  BOOL_T eq = row_equal (p, M_ROW_REAL, M_REAL);
+  PUSH_VALUE (p, (BOOL_T) ! eq, A68_BOOL);
+}
+
+//! @brief OP +:= = (REF [] REAL, [] REAL) REF [] REAL
+
+void genie_vector_plusab (NODE_T * p)
+{
+  row_operator_ab (p, M_REF_ROW_REAL, M_REAL, TORRIX_ADD, 0.0);
+}
+
+//! @brief OP -:= = (REF [] REAL, [] REAL) REF [] REAL
+
+void genie_vector_minusab (NODE_T * p)
+{
+  row_operator_ab (p, M_REF_ROW_REAL, M_REAL, TORRIX_SUB, 0.0);
+}
+
+//! @brief OP + = ([, ] REAL, [, ] REAL) [, ] REAL
+
+void genie_matrix_add (NODE_T * p)
+{
+  row_operator (p, M_ROW_ROW_REAL, M_REAL, TORRIX_ADD, A68_TRUE, 0.0);
+}
+
+//! @brief OP - = ([, ] REAL, [, ] REAL) [, ] REAL
+
+void genie_matrix_sub (NODE_T * p)
+{
+  row_operator (p, M_ROW_ROW_REAL, M_REAL, TORRIX_SUB, A68_TRUE, 0.0);
+}
+
+//! @brief OP = = ([, ] REAL, [, ] REAL) BOOL
+
+void genie_matrix_eq (NODE_T * p)
+{
+  BOOL_T eq = row_equal (p, M_ROW_ROW_REAL, M_REAL);
+  PUSH_VALUE (p, eq, A68_BOOL);
+}
+
+//! @brief OP /= = ([, ] REAL, [, ] REAL) BOOL
+
+void genie_matrix_ne (NODE_T * p)
+{
+  BOOL_T eq = row_equal (p, M_ROW_ROW_REAL, M_REAL);
+  PUSH_VALUE (p, (BOOL_T) ! eq, A68_BOOL);
+}
+
+//! @brief OP +:= = (REF [, ] REAL, [, ] REAL) REF [, ] REAL
+
+void genie_matrix_plusab (NODE_T * p)
+{
+  row_operator_ab (p, M_REF_ROW_ROW_REAL, M_REAL, TORRIX_ADD, 0.0);
+}
+
+//! @brief OP -:= = (REF [, ] REAL, [, ] REAL) REF [, ] REAL
+
+void genie_matrix_minusab (NODE_T * p)
+{
+  row_operator_ab (p, M_REF_ROW_ROW_REAL, M_REAL, TORRIX_SUB, 0.0);
+}
+
+//! @brief OP * = ([] REAL, REAL) [] REAL
+
+void genie_vector_scale_real (NODE_T * p)
+{
+  REAL_T c = pop_scale (p, M_ROW_REAL, TORRIX_MUL);
+  row_operator (p, M_ROW_REAL, M_REAL, TORRIX_MUL, A68_FALSE, c);
+}
+
+//! @brief OP * = (REAL, [] REAL) [] REAL
+
+void genie_real_scale_vector (NODE_T * p)
+{
+  A68_ROW u;
+  POP_REF (p, &u);
+  REAL_T c = pop_scale (p, M_ROW_REAL, TORRIX_MUL);
+  PUSH_REF (p, u);
+  row_operator (p, M_ROW_REAL, M_REAL, TORRIX_MUL, A68_FALSE, c);
+}
+
+//! @brief OP * = ([, ] REAL, REAL) [, ] REAL
+
+void genie_matrix_scale_real (NODE_T * p)
+{
+  REAL_T c = pop_scale (p, M_ROW_ROW_REAL, TORRIX_MUL);
+  row_operator (p, M_ROW_ROW_REAL, M_REAL, TORRIX_MUL, A68_FALSE, c);
+}
+
+//! @brief OP * = (REAL, [, ] REAL) [, ] REAL
+
+void genie_real_scale_matrix (NODE_T * p)
+{
+  A68_ROW u;
+  POP_REF (p, &u);
+  REAL_T c = pop_scale (p, M_ROW_ROW_REAL, TORRIX_MUL);
+  PUSH_REF (p, u);
+  row_operator (p, M_ROW_ROW_REAL, M_REAL, TORRIX_MUL, A68_FALSE, c);
+}
+
+//! @brief OP / = ([] REAL, REAL) [] REAL
+
+void genie_vector_div_real (NODE_T * p)
+{
+  REAL_T c = pop_scale (p, M_ROW_REAL, TORRIX_DIV);
+  row_operator (p, M_ROW_REAL, M_REAL, TORRIX_DIV, A68_FALSE, c);
+}
+
+//! @brief OP / = ([, ] REAL, REAL) [, ] REAL
+
+void genie_matrix_div_real (NODE_T * p)
+{
+  REAL_T c = pop_scale (p, M_ROW_ROW_REAL, TORRIX_DIV);
+  row_operator (p, M_ROW_ROW_REAL, M_REAL, TORRIX_DIV, A68_FALSE, c);
+}
+
+//! @brief OP *:= (REF [] REAL, REAL) REF [] REAL
+
+void genie_vector_scale_real_ab (NODE_T * p)
+{
+  REAL_T c = pop_scale (p, M_ROW_REAL, TORRIX_MUL);
+  row_operator_ab (p, M_REF_ROW_REAL, M_REAL, TORRIX_MUL, c);
+}
+
+//! @brief OP *:= (REF [, ] REAL, REAL) REF [, ] REAL
+
+void genie_matrix_scale_real_ab (NODE_T * p)
+{
+  REAL_T c = pop_scale (p, M_ROW_ROW_REAL, TORRIX_MUL);
+  row_operator_ab (p, M_REF_ROW_ROW_REAL, M_REAL, TORRIX_MUL, c);
+}
+
+//! @brief OP /:= (REF [] REAL, REAL) REF [] REAL
+
+void genie_vector_div_real_ab (NODE_T * p)
+{
+  REAL_T c = pop_scale (p, M_ROW_REAL, TORRIX_DIV);
+  row_operator_ab (p, M_REF_ROW_REAL, M_REAL, TORRIX_DIV, c);
+}
+
+//! @brief OP /:= (REF [, ] REAL, REAL) REF [, ] REAL
+
+void genie_matrix_div_real_ab (NODE_T * p)
+{
+  REAL_T c = pop_scale (p, M_ROW_ROW_REAL, TORRIX_DIV);
+  row_operator_ab (p, M_REF_ROW_ROW_REAL, M_REAL, TORRIX_DIV, c);
+}
+
+//! @brief OP * = ([] REAL, [] REAL) REAL
+
+void genie_vector_dot (NODE_T * p)
+{
+  A68_ROW u, v;
+  ROW_VIEW_T x, y;
+  POP_REF (p, &v);
+  POP_REF (p, &u);
+  row_view (p, &u, M_ROW_REAL, &x);
+  row_view (p, &v, M_ROW_REAL, &y);
+  row_view_conform (p, &x, &y);
+// Four partial sums, in the same order whatever the spans are.
+  REAL_T sum[4] = {0.0, 0.0, 0.0, 0.0};
+  unt init = INIT_MASK;
+  BYTE_T *bx = x.base, *by = y.base;
+  int k = 0;
+  for (; k + 4 <= x.len1; k += 4, bx += 4 * x.inc1, by += 4 * y.inc1) {
+    for (int j = 0; j < 4; j++) {
+      A68_REAL *s = (A68_REAL *) (bx + j * x.inc1), *t = (A68_REAL *) (by + j * y.inc1);
+      init &= STATUS (s) & STATUS (t);
+      sum[j] += VALUE (s) * VALUE (t);
+    }
+  }
+  for (int j = 0; k < x.len1; k++, j++, bx += x.inc1, by += y.inc1) {
+    A68_REAL *s = (A68_REAL *) bx, *t = (A68_REAL *) by;
+    init &= STATUS (s) & STATUS (t);
+    sum[j] += VALUE (s) * VALUE (t);
+  }
+  CHECK_INIT (p, init & INIT_MASK, M_REAL);
+  REAL_T w = (sum[0] + sum[1]) + (sum[2] + sum[3]);
+  CHECK_REAL (p, w);
+  PUSH_VALUE (p, w, A68_REAL);
+}
+
+//! @brief OP - = ([] INT) [] INT
+
+void genie_vector_minus_int (NODE_T * p)
+{
+  row_operator (p, M_ROW_INT, M_INT, TORRIX_NEG, A68_FALSE, 0.0);
+}
+
+//! @brief OP + = ([] INT, [] INT) [] INT
+
+void genie_vector_add_int (NODE_T * p)
+{
+  row_operator (p, M_ROW_INT, M_INT, TORRIX_ADD, A68_TRUE, 0.0);
+}
+
+//! @brief OP - = ([] INT, [] INT) [] INT
+
+void genie_vector_sub_int (NODE_T * p)
+{
+  row_operator (p, M_ROW_INT, M_INT, TORRIX_SUB, A68_TRUE, 0.0);
+}
+
+//! @brief OP = = ([] INT, [] INT) BOOL
+
+void genie_vector_eq_int (NODE_T * p)
+{
+  BOOL_T eq = row_equal (p, M_ROW_INT, M_INT);
+  PUSH_VALUE (p, eq, A68_BOOL);
+}
+
+//! @brief OP /= = ([] INT, [] INT) BOOL
+
+void genie_vector_ne_int (NODE_T * p)
+{
+  BOOL_T eq = row_equal (p, M_ROW_INT, M_INT);
+  PUSH_VALUE (p, (BOOL_T) ! eq, A68_BOOL);
+}
+
+//! @brief OP +:= = (REF [] INT, [] INT) REF [] INT
+
+void genie_vector_plusab_int (NODE_T * p)
+{
+  row_operator_ab (p, M_REF_ROW_INT, M_INT, TORRIX_ADD, 0.0);
+}
+
+//! @brief OP -:= = (REF [] INT, [] INT) REF [] INT
+
+void genie_vector_minusab_int (NODE_T * p)
+{
+  row_operator_ab (p, M_REF_ROW_INT, M_INT, TORRIX_SUB, 0.0);
+}
+
+// Matrix products.
+// C := alpha A B + beta C is computed blockwise. Blocks of B and of A are
+// packed into contiguous slivers of GEMM_NR columns and GEMM_MR rows, and a
+// register-blocked kernel accumulates each GEMM_MR x GEMM_NR tile of C over
+// a sliver pair. Block sizes keep a sliver of B in L1 and a block of A in L2.
+// Large products split the columns of C over threads. Matrices are passed as
+// REAL_T pointers with strides in REAL_T units, so that A68 rows, GSL
+// matrices and transposes all fit without copying.
+
+#define GEMM_MR 4
+#define GEMM_NR 4
+#define GEMM_MC 96
+#define GEMM_KC 256
+#define GEMM_NC 2048
+#define GEMM_SLICE 64
+#define GEMM_THREADS 16
+#define GEMM_PARALLEL (128.0 * 128.0 * 128.0)
+
+typedef struct GEMM_T GEMM_T;
+
+struct GEMM_T
+{
+  int m, n, k, ra, ca, rb, cb, rc, cc;
+  REAL_T alpha, beta, *a, *b, *c, *pa, *pb;
+};
+
+//! @brief GEMM_MR x GEMM_NR tile of the product of packed slivers.
+
+static void gemm_kernel (int kc, REAL_T * a, REAL_T * b, REAL_T * ab)
+{
+// Written out so the tile stays in registers; the compiler pairs the
+// multiplications into vector instructions.
+  REAL_T c00 = 0, c10 = 0, c20 = 0, c30 = 0, c01 = 0, c11 = 0, c21 = 0, c31 = 0;
+  REAL_T c02 = 0, c12 = 0, c22 = 0, c32 = 0, c03 = 0, c13 = 0, c23 = 0, c33 = 0;
+  for (int l = 0; l < kc; l++, a += GEMM_MR, b += GEMM_NR) {
+    REAL_T a0 = a[0], a1 = a[1], a2 = a[2], a3 = a[3];
+    REAL_T b0 = b[0], b1 = b[1], b2 = b[2], b3 = b[3];
+    c00 += a0 * b0; c10 += a1 * b0; c20 += a2 * b0; c30 += a3 * b0;
+    c01 += a0 * b1; c11 += a1 * b1; c21 += a2 * b1; c31 += a3 * b1;
+    c02 += a0 * b2; c12 += a1 * b2; c22 += a2 * b2; c32 += a3 * b2;
+    c03 += a0 * b3; c13 += a1 * b3; c23 += a2 * b3; c33 += a3 * b3;
+  }
+  ab[0] = c00; ab[1] = c10; ab[2] = c20; ab[3] = c30;
+  ab[4] = c01; ab[5] = c11; ab[6] = c21; ab[7] = c31;
+  ab[8] = c02; ab[9] = c12; ab[10] = c22; ab[11] = c32;
+  ab[12] = c03; ab[13] = c13; ab[14] = c23; ab[15] = c33;
+}
+
+//! @brief C := alpha A B + beta C for one slice, in the calling thread.
+
+static void gemm_block (GEMM_T * g)
+{
+  for (int jc = 0; jc < g->n; jc += GEMM_NC) {
+    int nc = MIN (GEMM_NC, g->n - jc);
+    for (int pc = 0; pc < g->k; pc += GEMM_KC) {
+      int kc = MIN (GEMM_KC, g->k - pc);
+// Pack B [pc + 1 .. pc + kc, jc + 1 .. jc + nc], padding with zeroes.
+      REAL_T *q = g->pb;
+      for (int jr = 0; jr < nc; jr += GEMM_NR) {
+        for (int l = 0; l < kc; l++) {
+          REAL_T *u = &g->b[(pc + l) * g->rb + (jc + jr) * g->cb];
+          for (int j = 0; j < GEMM_NR; j++) {
+            *q++ = (jr + j < nc ? u[j * g->cb] : 0.0);
+          }
+        }
+      }
+      for (int ic = 0; ic < g->m; ic += GEMM_MC) {
+        int mc = MIN (GEMM_MC, g->m - ic);
+// Pack alpha A [ic + 1 .. ic + mc, pc + 1 .. pc + kc], padding with zeroes.
+        q = g->pa;
+        for (int ir = 0; ir < mc; ir += GEMM_MR) {
+          for (int l = 0; l < kc; l++) {
+            REAL_T *u = &g->a[(ic + ir) * g->ra + (pc + l) * g->ca];
+            for (int i = 0; i < GEMM_MR; i++) {
+              *q++ = (ir + i < mc ? g->alpha * u[i * g->ra] : 0.0);
+            }
+          }
+        }
+        for (int jr = 0; jr < nc; jr += GEMM_NR) {
+          int nr = MIN (GEMM_NR, nc - jr);
+          for (int ir = 0; ir < mc; ir += GEMM_MR) {
+            int mr = MIN (GEMM_MR, mc - ir);
+            REAL_T ab[GEMM_MR * GEMM_NR];
+            gemm_kernel (kc, &g->pa[ir * kc], &g->pb[jr * kc], ab);
+            for (int j = 0; j < nr; j++) {
+              REAL_T *z = &g->c[(ic + ir) * g->rc + (jc + jr + j) * g->cc];
+              for (int i = 0; i < mr; i++, z += g->rc) {
+                REAL_T w = ab[j * GEMM_MR + i];
+                if (pc > 0) {
+                  *z += w;
+                } else if (g->beta == 0.0) {
+                  *z = w;
+                } else {
+                  *z = g->beta * *z + w;
+                }
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+#if defined (BUILD_PARALLEL_CLAUSE)
+
+//! @brief Thread running gemm_block.
+
+static void *gemm_thread (void *g)
+{
+  gemm_block ((GEMM_T *) g);
+  return NULL;
+}
+
+#endif
+
+//! @brief Number of threads for an m x k by k x n product.
+
+static int gemm_threads (int m, int n, int k)
+{
+#if defined (BUILD_PARALLEL_CLAUSE) && defined (_SC_NPROCESSORS_ONLN)
+  if ((REAL_T) m * (REAL_T) n * (REAL_T) k < GEMM_PARALLEL) {
+    return 1;
+  }
+  int cpus = (int) sysconf (_SC_NPROCESSORS_ONLN);
+  return MAX (1, MIN (MIN (cpus, GEMM_THREADS), n / GEMM_SLICE));
+#else
+  (void) m;
+  (void) n;
+  (void) k;
+  return 1;
+#endif
+}
+
+#if defined (HAVE_GSL)
+
+//! @brief C := alpha A B + beta C through the CBLAS library that GSL links.
+
+static void gemm_cblas (int m, int n, int k, REAL_T alpha, REAL_T * a, int ra, int ca, REAL_T * b, int rb, int cb, REAL_T beta, REAL_T * c, int rc, int cc)
+{
+// CBLAS needs unit stride in one dimension, so operands are packed column-major.
+  REAL_T *wa = (REAL_T *) get_heap_space (((size_t) m * k + (size_t) k * n + (size_t) m * n) * sizeof (REAL_T));
+  REAL_T *wb = &wa[(size_t) m * k], *wc = &wb[(size_t) k * n];
+  for (int j = 0; j < k; j++) {
+    for (int i = 0; i < m; i++) {
+      wa[(size_t) j * m + i] = a[i * ra + j * ca];
+    }
+  }
+  for (int j = 0; j < n; j++) {
+    for (int i = 0; i < k; i++) {
+      wb[(size_t) j * k + i] = b[i * rb + j * cb];
+    }
+    for (int i = 0; i < m; i++) {
+      wc[(size_t) j * m + i] = (beta == 0.0 ? 0.0 : c[i * rc + j * cc]);
+    }
+  }
+  cblas_dgemm (CblasColMajor, CblasNoTrans, CblasNoTrans, m, n, k, alpha, wa, m, wb, k, beta, wc, m);
+  for (int j = 0; j < n; j++) {
+    for (int i = 0; i < m; i++) {
+      c[i * rc + j * cc] = wc[(size_t) j * m + i];
+    }
+  }
+  a68_free (wa);
+}
+
+#endif
+
+//! @brief C := alpha A B + beta C, with A m x k, B k x n and C m x n.
+
+void torrix_dgemm (int m, int n, int k, REAL_T alpha, REAL_T * a, int ra, int ca, REAL_T * b, int rb, int cb, REAL_T beta, REAL_T * c, int rc, int cc)
+{
+// As in BLAS, C is not read when beta is zero.
+  if (m <= 0 || n <= 0) {
+    return;
+  }
+  if (k <= 0) {
+    for (int j = 0; j < n; j++) {
+      for (int i = 0; i < m; i++) {
+        REAL_T *z = &c[i * rc + j * cc];
+        *z = (beta == 0.0 ? 0.0 : beta * *z);
+      }
+    }
+    return;
+  }
+#if defined (HAVE_GSL)
+  if (OPTION_BLAS (&A68_JOB)) {
+    gemm_cblas (m, n, k, alpha, a, ra, ca, b, rb, cb, beta, c, rc, cc);
+    return;
+  }
+#endif
+// Split the columns of C in slices of whole slivers, one per thread.
+  int threads = gemm_threads (m, n, k);
+  int slice = ((n + threads - 1) / threads + GEMM_NR - 1) / GEMM_NR * GEMM_NR;
+  size_t pa_size = GEMM_MC * GEMM_KC;
+  size_t pb_size = (size_t) GEMM_KC * ((MIN (GEMM_NC, slice) + GEMM_NR - 1) / GEMM_NR * GEMM_NR);
+  REAL_T *work = (REAL_T *) get_heap_space ((size_t) threads * (pa_size + pb_size) * sizeof (REAL_T));
+  GEMM_T g[GEMM_THREADS];
+  int slices = 0;
+  for (int jc = 0; jc < n; jc += slice, slices++) {
+    GEMM_T *w = &g[slices];
+    w->m = m; w->n = MIN (slice, n - jc); w->k = k;
+    w->alpha = alpha; w->beta = beta;
+    w->a = a; w->ra = ra; w->ca = ca;
+    w->b = &b[jc * cb]; w->rb = rb; w->cb = cb;
+    w->c = &c[jc * cc]; w->rc = rc; w->cc = cc;
+    w->pa = &work[slices * (pa_size + pb_size)];
+    w->pb = &w->pa[pa_size];
+  }
+#if defined (BUILD_PARALLEL_CLAUSE)
+  pthread_t id[GEMM_THREADS];
+  BOOL_T started[GEMM_THREADS];
+  for (int t = 1; t < slices; t++) {
+    started[t] = (pthread_create (&id[t], NULL, gemm_thread, &g[t]) == 0);
+    if (!started[t]) {
+      gemm_block (&g[t]);
+    }
+  }
+  gemm_block (&g[0]);
+  for (int t = 1; t < slices; t++) {
+    if (started[t]) {
+      ASSERT (pthread_join (id[t], NULL) == 0);
+    }
+  }
+#else
+  for (int t = 0; t < slices; t++) {
+    gemm_block (&g[t]);
+  }
+#endif
+  a68_free (work);
+}
+
+//! @brief REAL_T address and strides of the REAL at "offset" in the elements of "v".
+
+static REAL_T *row_view_real (ROW_VIEW_T * v, int offset, int *r, int *c)
+{
+  *r = v->inc1 / (int) sizeof (REAL_T);
+  *c = v->inc2 / (int) sizeof (REAL_T);
+  if (v->base == NO_BYTE) {
+    return NO_REAL;
+  } else {
+    return &VALUE ((A68_REAL *) (v->base + offset));
+  }
+}
+
+//! @brief Check that all REAL parts in the elements of "v" are initialised.
+
+static void row_view_check (NODE_T * p, MOID_T * e, ROW_VIEW_T * v)
+{
+  int parts = SIZE (e) / SIZE (M_REAL);
+  unt init = INIT_MASK;
+  BYTE_T *u = v->base;
+  for (int j = 0; j < v->len2 && u != NO_BYTE; j++, u += v->inc2) {
+    for (int k = 0; k < v->len1; k++) {
+      for (int l = 0; l < parts; l++) {
+        init &= STATUS ((A68_REAL *) (u + k * v->inc1 + l * SIZE (M_REAL)));
+      }
+    }
+  }
+  CHECK_INIT (p, init & INIT_MASK, e);
+}
+
+//! @brief Mark the REAL parts in the elements of "z" initialised and check them.
+
+static void row_view_seal (NODE_T * p, MOID_T * e, ROW_VIEW_T * z)
+{
+// "r - r" is zero unless "r" is infinite or NaN.
+  int parts = SIZE (e) / SIZE (M_REAL);
+  unt bad = 0;
+  BYTE_T *u = z->base;
+  for (int j = 0; j < z->len2; j++, u += z->inc2) {
+    for (int k = 0; k < z->len1; k++) {
+      for (int l = 0; l < parts; l++) {
+        A68_REAL *x = (A68_REAL *) (u + k * z->inc1 + l * SIZE (M_REAL));
+        REAL_T r = VALUE (x);
+        STATUS (x) = INIT_MASK;
+        bad |= (r - r != 0);
+      }
+    }
+  }
+  PRELUDE_ERROR (bad, p, ERROR_INFINITE, e);
+}
+
+//! @brief Product of two [, ] REAL or two [, ] COMPLEX.
+
+static void matrix_times_matrix (NODE_T * p, MOID_T * m, MOID_T * e)
+{
+  A68_ROW u, v;
+  ROW_VIEW_T x, y, z;
+  POP_REF (p, &v);
+  POP_REF (p, &u);
+  row_view (p, &u, m, &x);
+  row_view (p, &v, m, &y);
+  if (x.len2 != y.len1) {
+    diagnostic (A68_RUNTIME_ERROR, p, ERROR_DIFFERENT_BOUNDS);
+    exit_genie (p, A68_RUNTIME_ERROR);
+  }
+  row_view_check (p, e, &x);
+  row_view_check (p, e, &y);
+  ROW_VIEW_T w = {NO_BYTE, x.len1, y.len2, 0, 0};
+  A68_ROW desc = row_view_new (p, m, e, &w, &z);
+  if (z.base != NO_BYTE) {
+    int ra, ca, rb, cb, rc, cc, len = x.len2;
+    if (e == M_REAL) {
+      REAL_T *a = row_view_real (&x, 0, &ra, &ca), *b = row_view_real (&y, 0, &rb, &cb);
+      REAL_T *c = row_view_real (&z, 0, &rc, &cc);
+      torrix_dgemm (z.len1, z.len2, len, 1.0, a, ra, ca, b, rb, cb, 0.0, c, rc, cc);
+    } else {
+// (ar + i ai) (br + i bi) = (ar br - ai bi) + i (ar bi + ai br).
+      int im = SIZE (M_REAL);
+      REAL_T *ar = row_view_real (&x, 0, &ra, &ca), *ai = row_view_real (&x, im, &ra, &ca);
+      REAL_T *br = row_view_real (&y, 0, &rb, &cb), *bi = row_view_real (&y, im, &rb, &cb);
+      REAL_T *cr = row_view_real (&z, 0, &rc, &cc), *ci = row_view_real (&z, im, &rc, &cc);
+      torrix_dgemm (z.len1, z.len2, len, 1.0, ar, ra, ca, br, rb, cb, 0.0, cr, rc, cc);
+      torrix_dgemm (z.len1, z.len2, len, -1.0, ai, ra, ca, bi, rb, cb, 1.0, cr, rc, cc);
+      torrix_dgemm (z.len1, z.len2, len, 1.0, ar, ra, ca, bi, rb, cb, 0.0, ci, rc, cc);
+      torrix_dgemm (z.len1, z.len2, len, 1.0, ai, ra, ca, br, rb, cb, 1.0, ci, rc, cc);
+    }
+    row_view_seal (p, e, &z);
+  }
+  PUSH_REF (p, desc);
+}
+
+//! @brief OP * = ([, ] REAL, [, ] REAL) [, ] REAL
+
+void genie_matrix_times_matrix (NODE_T * p)
+{
+  matrix_times_matrix (p, M_ROW_ROW_REAL, M_REAL);
+}
+
+//! @brief OP * = ([, ] COMPLEX, [, ] COMPLEX) [, ] COMPLEX
+
+void genie_matrix_complex_times_matrix (NODE_T * p)
+{
+  matrix_times_matrix (p, M_ROW_ROW_COMPLEX, M_COMPLEX);
+}
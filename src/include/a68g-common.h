@@ -72,6 +72,33 @@ struct MODE_CACHE_T
   MOID_T *proc_void;
 };
 
+// Memo of coercibility between modes, filled during mode checking.
+
+#define COERCION_MEMO_SIZE 4096
+
+typedef struct COERCION_T COERCION_T;
+struct COERCION_T
+{
+  MOID_T *from, *to;
+  int sort, deflex;
+  BOOL_T coercible;
+};
+
+// Live postulates are indexed by hash of their pair of modes.
+
+#define POSTULATE_BUCKETS 1024
+
+// Pairs of modes found not to be equivalent in the current proof.
+
+#define DISPROOF_BUCKETS 4096
+
+typedef struct DISPROOF_T DISPROOF_T;
+struct DISPROOF_T
+{
+  MOID_T *a, *b;
+  unt proof;
+};
+
 #define MAX_OPEN_FILES 64       // Some OS's won't open more than this number
 #define MAX_TRANSPUT_BUFFER (MAX_OPEN_FILES)
 
@@ -79,9 +106,11 @@ typedef struct FILE_ENTRY FILE_ENTRY;
 struct FILE_ENTRY
 {
   NODE_T *pos;
-  BOOL_T is_open, is_tmp;
+  BOOL_T is_open, is_tmp, is_regular, is_mapped;
   FILE_T fd;
   A68_REF idf;
+  char *read_buffer;
+  size_t read_index, read_size, map_size;
 };
 
 // Administration for common (sub) expression elimination.
@@ -105,6 +134,14 @@ struct UNIC_T
   char *fun;
 };
 
+typedef struct PLUGIN_UNIT_T PLUGIN_UNIT_T;
+struct PLUGIN_UNIT_T
+{
+  char *source, *object, *binary, *prefix;
+  FILE_T fd;
+  int base;
+};
+
 
 #define A68(z)         (common.z)
 #define A68_JOB        A68 (job)
@@ -119,12 +156,26 @@ struct UNIC_T
 #define A68_HEAP       A68 (heap_segment)
 #define A68_HANDLES    A68 (handle_segment)
 
+// Freed blocks are recycled through segregated free lists. Blocks up to
+// HEAP_SMALL_CLASSES alignment units each have an exact-fit list, larger
+// blocks go into a list per power of two.
+
+#define HEAP_SMALL_CLASSES 64
+#define HEAP_FREE_LISTS (HEAP_SMALL_CLASSES + 32)
+
+// Handles are kept in a table, with one bit per handle in a map.
+
+#define HANDLE_MAP_BITS ((int) (8 * sizeof (unt)))
+
 typedef struct GC_GLOBALS_T GC_GLOBALS_T;
 #define A68_GC(z)      A68 (gc.z)
 struct GC_GLOBALS_T
 {
-  A68_HANDLE *available_handles, *busy_handles;
-  UNSIGNED_T free_handles, max_handles, sweeps, refused, freed, total;
+  unt *handle_map;
+  BYTE_T *free_blocks[HEAP_FREE_LISTS];
+  ADDR_T heap_budget, hole_bytes;
+  UNSIGNED_T free_handles, max_handles, sweeps, refused, freed, total, allocated;
+  UNSIGNED_T handle_budget, map_words, free_word, top_word, clean_word;
   unt preemptive, sema;
   REAL_T seconds;
 };
@@ -160,6 +211,16 @@ struct MONITOR_GLOBALS_T
   MOID_T *_m_stack[MON_STACK_SIZE];
 };
 
+typedef struct PROFILE_GLOBALS_T PROFILE_GLOBALS_T;
+#define A68_PROF(z)    A68 (prof.z)
+struct PROFILE_GLOBALS_T
+{
+  PROFILE_T *records;
+  PROFILE_CONTEXT_T *root;
+  PROFILE_FRAME_T *stack;
+  int sp, size;
+};
+
 typedef struct MP_GLOBALS_T MP_GLOBALS_T;
 #define A68_MP(z)      A68 (mp.z)
 
@@ -171,6 +232,10 @@ struct MP_GLOBALS_T
   int mp_one_size;
   int mp_pi_size;
   int varying_mp_digits;
+  size_t mp_scratch_size;
+  size_t mp_scratch_top;
+  size_t mp_scratch_want;
+  BYTE_T *mp_scratch;
   MP_T *mp_180_over_pi;
   MP_T **mp_gam_ck;
   MP_T *mp_half_pi;
@@ -185,8 +250,34 @@ struct MP_GLOBALS_T
   MP_T *mp_two_pi;
 };
 
+// Compiled regular expressions, most recently used last.
+
+#define REGEX_CACHE_SIZE 16
+
+typedef struct REGEX_ENTRY_T REGEX_ENTRY_T;
+
+struct REGEX_ENTRY_T
+{
+  char *pattern;
+  int cflags, nmatch;
+  regex_t compiled;
+  regmatch_t *matches;
+  unt stamp;
+};
+
+typedef struct REGEX_GLOBALS_T REGEX_GLOBALS_T;
+#define A68_REGEX(z)   A68 (regex.z)
+
+struct REGEX_GLOBALS_T
+{
+  REGEX_ENTRY_T cache[REGEX_CACHE_SIZE];
+  unt clock;
+  INT_T hits, misses;
+};
+
 #define MAX_BOOK 1024
 #define MAX_UNIC 2048
+#define MAX_PLUGIN_UNITS 32
 
 typedef struct OPTIMISER_GLOBALS_T OPTIMISER_GLOBALS_T;
 #define A68_OPT(z)     A68 (optimiser.z)
@@ -202,6 +293,10 @@ struct OPTIMISER_GLOBALS_T
   int procedures;
   int unic_pointer;
   UNIC_T unic_functions[MAX_UNIC];
+  int units;
+  PLUGIN_UNIT_T unit[MAX_PLUGIN_UNITS];
+  char *unit_prefix;
+  int unit_base;
 };
 
 #if defined (BUILD_PARALLEL_CLAUSE)
@@ -252,6 +347,7 @@ struct PARALLEL_GLOBALS_T
   int par_return_code;
   jmp_buf *jump_buffer;
   NODE_T *jump_label;
+  pthread_cond_t unit_done;
   pthread_mutex_t unit_sema;
   pthread_t main_thread_id;
   pthread_t parent_thread_id;
@@ -265,6 +361,9 @@ struct PARSER_GLOBALS_T
 {
   TAG_T *error_tag;
   BOOL_T stop_scanner, read_error, no_preprocessing;
+  MOID_T **mode_index;
+  int mode_index_size, mode_index_used;
+  TAG_INDEX_T *tag_indices;
   char *scan_buf;
   int max_scan_buf_length, source_file_size;
   int reductions;
@@ -299,6 +398,8 @@ struct GLOBALS_T
   char *marker[BUFFER_SIZE];
   BUFFER output_line, edit_line, input_line;
   clock_t clock_res;
+  COERCION_T coercion_memo[COERCION_MEMO_SIZE];
+  DISPROOF_T disproofs[DISPROOF_BUCKETS];
   FILE_ENTRY file_entries[MAX_OPEN_FILES];
   GC_GLOBALS_T gc;
   INDENT_GLOBALS_T indent;
@@ -322,7 +423,10 @@ struct GLOBALS_T
   OPTIMISER_GLOBALS_T optimiser;
   OPTIONS_T *options;
   PARSER_GLOBALS_T parser;
+  PROFILE_GLOBALS_T prof;
+  REGEX_GLOBALS_T regex;
   POSTULATE_T *postulates, *top_postulate, *top_postulate_list;
+  POSTULATE_T *postulate_index[POSTULATE_BUCKETS];
   REAL_T cputime_0;
   SOID_T *top_soid_list;
   TABLE_T *standenv;
@@ -330,7 +434,7 @@ struct GLOBALS_T
   TOKEN_T *top_token;
   unt frame_stack_size, expr_stack_size, heap_size, handle_pool_size, stack_size;
   unt stack_limit, frame_stack_limit, expr_stack_limit;
-  unt storage_overhead;
+  unt proof_count, storage_overhead;
 #if defined (BUILD_PARALLEL_CLAUSE)
   PARALLEL_GLOBALS_T parallel;
 #endif
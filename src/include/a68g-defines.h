@@ -56,6 +56,8 @@
 #define BINARY_EXTENSION ".o"
 #define PLUGIN_EXTENSION ".so"
 #define LISTING_EXTENSION ".l"
+#define PROFILE_EXTENSION ".prof"
+#define STACKS_EXTENSION ".folded"
 #define OBJECT_EXTENSION ".c"
 #define PRETTY_EXTENSION ".f"
 #define SCRIPT_EXTENSION ""
@@ -78,6 +80,7 @@
 #define MAX_RESTART 256
 
 #define A68_DIR ".a68g"
+#define A68_CACHE_DIR "cache"
 #define A68_HISTORY_FILE ".a68g.edit.hist"
 #define A68_NO_FILE ((FILE_T) -1)
 #define A68_PROTECTION (S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH)  // -rw-r--r--
@@ -104,7 +107,9 @@
 #define NOT_EMBEDDED_FORMAT A68_FALSE
 #define NOT_PRINTED 1
 #define OVER_2G(n) ((REAL_T) (n) > (REAL_T) (2 * GIGABYTE)) 
+#define MMAP_THRESHOLD ((size_t) (4 * MEGABYTE))
 #define PRIMAL_SCOPE 0
+#define READ_BUFFER_SIZE ((int) (64 * KILOBYTE))
 #define SKIP_PATTERN A68_FALSE
 #define SMALL_BUFFER_SIZE 128
 #define SNPRINTF_SIZE ((size_t) (BUFFER_SIZE - 1))
@@ -239,18 +244,27 @@
 #define ARRAY(p) ((p)->array)
 #define ATTRIBUTE(p) ((p)->attribute)
 #define B(p) ((p)->b)
+#define BASE(p) ((p)->base)
 #define BEGIN(p) ((p)->begin)
 #define BIN(p) ((p)->bin)
+#define BINARY(p) ((p)->binary)
 #define BITS_PER_SAMPLE(p) ((p)->bits_per_sample)
 #define BLUE(p) ((p)->blue)
 #define BODY(p) ((p)->body)
 #define BSTATE(p) ((p)->bstate)
+#define BYTECODE(p) ((p)->bytecode)
 #define BYTES(p) ((p)->bytes)
+#define CALLEE_HEAP(p) ((p)->callee_heap)
+#define CALLEES(p) ((p)->callees)
+#define CALLER(p) ((p)->caller)
+#define CALL_CONTEXT(p) ((p)->context)
 #define CAST(p) ((p)->cast)
 #define CAT(p) ((p)->cat)
 #define CHANNEL(p) ((p)->channel)
 #define CHAR_IN_LINE(p) ((p)->char_in_line)
 #define CHAR_MOOD(p) ((p)->char_mood)
+#define CHILDREN(p) ((p)->children)
+#define CHILD_HEAP(p) ((p)->child_heap)
 #define CMD(p) ((p)->cmd)
 #define CMD_ROW(p) ((p)->cmd_row)
 #define CODE(p) ((p)->code)
@@ -293,6 +307,8 @@
 #define EQUIVALENT(p) ((p)->equivalent_mode)
 #define EQUIVALENT_MODE(p) ((p)->equivalent_mode)
 #define ERROR_COUNT(p) ((p)->error_count)
+#define EXCLUSIVE(p) ((p)->exclusive)
+#define INCLUSIVE(p) ((p)->inclusive)
 #define RENDEZ_VOUS(p) ((p)->rendez_vous)
 #define EXPR(p) ((p)->expr)
 #define F(p) ((p)->f)
@@ -344,6 +360,7 @@
 #define FRAME_NO(p) ((p)->frame_no)
 #define FRAME_POINTER(p) ((p)->frame_pointer)
 #define FUNCTION(p) ((p)->function)
+#define FUSED(p) ((p)->fused)
 #define G(p) ((p)->g)
 #define GINFO(p) ((p)->genie)
 #define GET(p) ((p)->get)
@@ -356,16 +373,19 @@
 #define HEAP(p) ((p)->heap)
 #define HEAP_POINTER(p) ((p)->heap_pointer)
 // #define H_ADDR(p) ((p)->h_addr) only available with __USE_MISC allowing ancient features (4.3BSD and SysV). 
+#define HOMONYM(p) ((p)->homonym)
 #define H_ADDR(p) ((p)->h_addr_list[0]) 
 #define H_LENGTH(p) ((p)->h_length)
 #define ID(p) ((p)->id)
 #define IDENTIFICATION(p) ((p)->identification)
 #define IDENTIFIERS(p) ((p)->identifiers)
+#define IDENTIFIER_INDEX(p) ((p)->identifier_index)
 #define IDF(p) ((p)->idf)
 #define IM(z) (VALUE (&(z)[1]))
 #define IN(p) ((p)->in)
 #define INDEX(p) ((p)->index)
 #define INDICANTS(p) ((p)->indicants)
+#define INDICANT_INDEX(p) ((p)->indicant_index)
 #define INFO(p) ((p)->info)
 #define INITIALISE_ANON(p) ((p)->initialise_anon)
 #define INITIALISE_FRAME(p) ((p)->initialise_frame)
@@ -377,12 +397,15 @@
 #define IN_PROC(p) ((p)->in_proc)
 #define IN_TEXT(p) ((p)->in_text)
 #define IS_COMPILED(p) ((p)->is_compiled)
+#define IS_MAPPED(p) ((p)->is_mapped)
 #define IS_OPEN(p) ((p)->is_open)
+#define IS_REGULAR(p) ((p)->is_regular)
 #define IS_TMP(p) ((p)->is_tmp)
 #define JUMP_STAT(p) ((p)->jump_stat)
 #define JUMP_TO(p) ((p)->jump_to)
 #define K(q) ((q)->k)
 #define LABELS(p) ((p)->labels)
+#define LABEL_INDEX(p) ((p)->label_index)
 #define LAST(p) ((p)->last)
 #define LAST_LINE(p) ((p)->last_line)
 #define LESS(p) ((p)->less)
@@ -401,6 +424,7 @@
 #define LOC_ASSIGNED(p) ((p)->loc_assigned)
 #define LOWER_BOUND(p) ((p)->lower_bound)
 #define LWB(p) ((p)->lower_bound)
+#define MAP_SIZE(p) ((p)->map_size)
 #define MARKER(p) ((p)->marker)
 #define MATCH(p) ((p)->match)
 #define MODIFIED(p) ((p)->modified)
@@ -435,15 +459,19 @@
 #define NUM_CHANNELS(p) ((p)->num_channels)
 #define NUM_MATCH(p) ((p)->num_match)
 #define NUM_SAMPLES(p) ((p)->num_samples)
+#define OBJECT(p) ((p)->object)
 #define OFFSET(p) ((p)->offset)
 #define OPENED(p) ((p)->opened)
 #define OPEN_ERROR_MENDED(p) ((p)->open_error_mended)
 #define OPEN_EXCLUSIVE(p) ((p)->open_exclusive)
 #define OPER(p) ((p)->oper)
 #define OPERATORS(p) ((p)->operators)
+#define OPERATOR_INDEX(p) ((p)->operator_index)
 #define OPTIONS(p) ((p)->options)
 #define OPTION_BACKTRACE(p) (OPTIONS (p).backtrace)
+#define OPTION_BLAS(p) (OPTIONS (p).blas)
 #define OPTION_BRACKETS(p) (OPTIONS (p).brackets)
+#define OPTION_BYTECODE(p) (OPTIONS (p).bytecode)
 #define OPTION_CHECK_ONLY(p) (OPTIONS (p).check_only)
 #define OPTION_CLOCK(p) (OPTIONS (p).clock)
 #define OPTION_COMPILE(p) (OPTIONS (p).compile)
@@ -453,6 +481,7 @@
 #define OPTION_FOLD(p) (OPTIONS (p).fold)
 #define OPTION_INDENT(p) (OPTIONS (p).indent)
 #define OPTION_KEEP(p) (OPTIONS (p).keep)
+#define OPTION_CACHE(p) (OPTIONS (p).cache)
 #define OPTION_LICENSE(p) (OPTIONS (p).license)
 #define OPTION_LIST(p) (OPTIONS (p).list)
 #define OPTION_LOCAL(p) (OPTIONS (p).local)
@@ -477,6 +506,7 @@
 #define OPTION_STROPPING(p) (OPTIONS (p).stropping)
 #define OPTION_TIME_LIMIT(p) (OPTIONS (p).time_limit)
 #define OPTION_TRACE(p) (OPTIONS (p).trace)
+#define OPTION_PROFILE(p) (OPTIONS (p).profile)
 #define OPTION_TREE_LISTING(p) (OPTIONS (p).tree_listing)
 #define OPTION_UNUSED(p) (OPTIONS (p).unused)
 #define OPTION_VERBOSE(p) (OPTIONS (p).verbose)
@@ -506,10 +536,13 @@
 #define PRAGMENT(p) ((p)->pragment)
 #define PRAGMENT_TYPE(p) ((p)->pragment_type)
 #define PRECMD(p) ((p)->precmd)
+#define PREFIX(p) ((p)->prefix)
 #define PREVIOUS(p) ((p)->previous)
 #define PRINT_STATUS(p) ((p)->print_status)
 #define PRIO(p) ((p)->priority)
+#define PRIORITY_INDEX(p) ((p)->priority_index)
 #define PROCEDURE(p) ((p)->procedure)
+#define PROFILE(p) ((p)->profile)
 #define PROCEDURE_LEVEL(p) ((p)->procedure_level)
 #define PROCESSED(p) ((p)->processed)
 #define PROC_FRAME(p) ((p)->proc_frame)
@@ -521,7 +554,10 @@
 #define P_PROTO(p) ((p)->p_proto)
 #define R(p) ((p)->r)
 #define RE(z) (VALUE (&(z)[0]))
+#define READ_BUFFER(p) ((p)->read_buffer)
+#define READ_INDEX(p) ((p)->read_index)
 #define READ_MOOD(p) ((p)->read_mood)
+#define READ_SIZE(p) ((p)->read_size)
 #define RED(p) ((p)->red)
 #define REPL(p) ((p)->repl)
 #define RESERVED(p) ((p)->reserved)
@@ -532,6 +568,7 @@
 #define RLIM_MAX(p) ((p)->rlim_max)
 #define RM_EO(p) ((p)->rm_eo)
 #define RM_SO(p) ((p)->rm_so)
+#define ROUTINE(p) ((p)->routine)
 #define ROWED(p) ((p)->rowed)
 #define S(p) ((p)->s)
 #define SAMPLE_RATE(p) ((p)->sample_rate)
@@ -546,6 +583,7 @@
 #define SCOPE_ASSIGNED(p) ((p)->scope_assigned)
 #define SEARCH(p) ((p)->search)
 #define SELECT(p) ((p)->select)
+#define SELF_TIME(p) ((p)->self_time)
 #define SEQUENCE(p) ((p)->sequence)
 #define SET(p) ((p)->set)
 #define SHIFT(p) ((p)->shift)
@@ -559,6 +597,7 @@
 #define SIZE_COMPL(p) ((p)->size_compl)
 #define SLICE(p) ((p)->slice)
 #define SLICE_OFFSET(p) ((p)->slice_offset)
+#define SLOTS(p) ((p)->slots)
 #define SO(p) ((p)->so)
 #define SORT(p) ((p)->sort)
 #define SOURCE(p) ((p)->source)
@@ -575,9 +614,11 @@
 #define STATUS_RE(z) (STATUS (&(z)[0]))
 #define STR(p) ((p)->str)
 #define STREAM(p) ((p)->stream)
+#define STRIDE(p) ((p)->stride)
 #define STRING(p) ((p)->string)
 #define STRPOS(p) ((p)->strpos)
 #define ST_MODE(p) ((p)->st_mode)
+#define ST_SIZE(p) ((p)->st_size)
 #define ST_MTIME(p) ((p)->st_mtime)
 #define SUB(p) ((p)->sub)
 #define SUBSET(p) ((p)->subset)
@@ -589,12 +630,14 @@
 #define SYNC(p) ((p)->sync)
 #define SYNC_INDEX(p) ((p)->sync_index)
 #define SYNC_LINE(p) ((p)->sync_line)
+#define SYSTEM_DEPTH(p) ((p)->system_depth)
 #define S_PORT(p) ((p)->s_port)
 #define TABLE(p) ((p)->symbol_table)
 #define TABS(p) ((p)->tabs)
 #define TAG_LEX_LEVEL(p) (LEVEL (TAG_TABLE (p)))
 #define TAG_TABLE(p) ((p)->symbol_table)
 #define TAX(p) ((p)->tag)
+#define TDA(p) ((p)->tda)
 #define TERM(p) ((p)->term)
 #define TERMINATOR(p) ((p)->terminator)
 #define TEXT(p) ((p)->text)
@@ -631,6 +674,7 @@
 #define UPB(p) ((p)->upper_bound)
 #define UPPER_BOUND(p) ((p)->upper_bound)
 #define USE(p) ((p)->use)
+#define USED(p) ((p)->used)
 #define VAL(p) ((p)->val)
 #define VALUE(p) ((p)->value)
 #define VALUE_ERROR_MENDED(p) ((p)->value_error_mended)
@@ -639,6 +683,7 @@
 #define IS_FLEXETY_ROW(m) (IS_FLEX (m) || IS_ROW (m) || m == M_STRING)
 #define IS_COERCION(p) ((p)->is_coercion)
 #define IS_FLEX(m) IS ((m), FLEX_SYMBOL)
+#define IS_INITIALISED(p) ((p)->is_initialised)
 #define IS_LITERALLY(p, s) (strcmp (NSYMBOL (p), s) == 0)
 #define IS_NEW_LEXICAL_LEVEL(p) ((p)->is_new_lexical_level)
 #define ISNT(p, s) (! IS (p, s))
@@ -96,6 +96,11 @@
 
 #define DESCRIPTOR_SIZE(n) (SIZE_ALIGNED (A68_ARRAY) + (n) * SIZE_ALIGNED (A68_TUPLE))
 
+// A STRING grown by +:= lives in a buffer with spare room. The first element
+// slot is a header that counts the characters in use.
+
+#define MIN_STRING_BUFFER 16
+
 #define NEW_ROW_1D(des, row, arr, tup, row_m, mod, upb)\
   (des) = heap_generator (p, (row_m), DESCRIPTOR_SIZE (1));\
   (row) = heap_generator (p, (row_m), (upb) * SIZE (mod));\
@@ -138,6 +143,10 @@
 #define ROW_ELEMENT(arr, k) (((ADDR_T) k + SLICE_OFFSET (arr)) * ELEM_SIZE (arr) + FIELD_OFFSET (arr))
 #define INDEX_1_DIM(arr, tup, k) ROW_ELEMENT (arr, (SPAN (tup) * (int) (k) - SHIFT (tup)))
 
+// Distance in bytes between successive elements of a 1-dim row.
+
+#define STRIDE_1_DIM(arr, tup) (SPAN (tup) * ELEM_SIZE (arr))
+
 #define VECTOR_OFFSET(arr, tup)\
   ((LWB (tup) * SPAN (tup) - SHIFT (tup) + SLICE_OFFSET (arr)) * ELEM_SIZE (arr) + FIELD_OFFSET (arr))
 
@@ -169,7 +178,23 @@
       BREAKPOINT_INTERRUPT_MASK | BREAKPOINT_WATCH_MASK | BREAKPOINT_TRACE_MASK))) {\
     single_step ((p), STATUS (p));\
   }\
-  GENIE_UNIT (p);}
+  if (STATUS_TEST (p, PROFILE_MASK)) {\
+    profile_unit (p);\
+  } else {\
+    GENIE_UNIT (p);\
+  }}
+
+// Execute the body of a routine, accounting the call when profiling.
+
+#define GENIE_ROUTINE_TRACE(body, entry) {\
+  if (OPTION_PROFILE (&A68_JOB)) {\
+    BYTE_T _sp_;\
+    profile_call ((body), &_sp_);\
+    GENIE_UNIT_TRACE (entry);\
+    profile_return (&_sp_);\
+  } else {\
+    GENIE_UNIT_TRACE (entry);\
+  }}
 
 // Stuff for the garbage collector
 
@@ -177,6 +202,17 @@
 
 #define DEFAULT_PREEMPTIVE 0.8
 
+// After a sweep, allocate this fraction of the free heap before the next
+// preemptive sweep, so a heap that stays nearly full is not swept at every
+// serial clause.
+
+#define DEFAULT_GC_BUDGET 0.25
+
+// The heap is only compacted when holes on the free lists exceed this 
+// fraction of the used heap.
+
+#define DEFAULT_FRAGMENTATION 0.25
+
 // Save a handle from the GC
 
 #define BLOCK_GC_HANDLE(z) {\
@@ -399,6 +435,7 @@ PROP_T genie_assertion (NODE_T *);
 PROP_T genie_assignation_constant (NODE_T *);
 PROP_T genie_assignation (NODE_T *);
 PROP_T genie_assignation_quick (NODE_T * p);
+PROP_T genie_bytecode (NODE_T *);
 PROP_T genie_call (NODE_T *);
 PROP_T genie_cast (NODE_T *);
 PROP_T genie_closed (volatile NODE_T *);
@@ -410,6 +447,9 @@ PROP_T genie_denotation (NODE_T *);
 PROP_T genie_deproceduring (NODE_T *);
 PROP_T genie_dereference_frame_identifier (NODE_T *);
 PROP_T genie_dereference_generic_identifier (NODE_T *);
+PROP_T genie_dereference_loc_identifier (NODE_T *);
+PROP_T genie_dereference_loc_int (NODE_T *);
+PROP_T genie_dereference_loc_real (NODE_T *);
 PROP_T genie_dereference_selection_name_quick (NODE_T *);
 PROP_T genie_dereference_slice_name_quick (NODE_T *);
 PROP_T genie_dereferencing (NODE_T *);
@@ -448,6 +488,7 @@ PROP_T genie_uniting (NODE_T *);
 PROP_T genie_unit (NODE_T *);
 PROP_T genie_voiding_assignation_constant (NODE_T *);
 PROP_T genie_voiding_assignation (NODE_T *);
+PROP_T genie_voiding_assignation_identifier (NODE_T *);
 PROP_T genie_voiding (NODE_T *);
 PROP_T genie_widen_int_to_real (NODE_T *);
 PROP_T genie_widen (NODE_T *);
@@ -458,6 +499,8 @@ A68_REF genie_make_ref_row_row (NODE_T *, MOID_T *, MOID_T *, ADDR_T);
 A68_REF genie_make_rowrow (NODE_T *, MOID_T *, int, ADDR_T);
 
 void genie (void *);
+BOOL_T genie_bytecode_loop (NODE_T *, INT_T, INT_T, INT_T);
+void genie_bytecode_candidate (NODE_T *, PROP_T *);
 void genie_clone_stack (NODE_T *, MOID_T *, A68_REF *, A68_REF *);
 void genie_serial_units_no_label (NODE_T *, ADDR_T, NODE_T **);
 void genie_jump (NODE_T *);
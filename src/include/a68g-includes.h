@@ -183,6 +183,10 @@
 #  include <sys/wait.h>
 #endif
 
+#if (defined (BUILD_LINUX) || defined (BUILD_BSD))
+#  include <sys/mman.h>
+#endif
+
 #if defined (HAVE_GNU_MPFR)
 #  define MPFR_WANT_FLOAT128
 #  include <gmp.h>
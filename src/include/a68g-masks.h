@@ -67,6 +67,8 @@
 #define BREAKPOINT_WATCH_MASK     ((STATUS_MASK_T) 0x10000000)
 #define BREAKPOINT_TRACE_MASK     ((STATUS_MASK_T) 0x20000000)
 #define SEQUENCE_MASK             ((STATUS_MASK_T) 0x40000000)
+#define GROWABLE_MASK             ((STATUS_MASK_T) 0x80000000)
+#define PROFILE_MASK              ((STATUS_MASK_T) 0x80000000)
 #define BREAKPOINT_ERROR_MASK     ((STATUS_MASK_T) 0xffffffff)
 
 // CODEX masks
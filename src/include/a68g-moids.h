@@ -79,6 +79,7 @@ void coerce_formula (NODE_T *, SOID_T *);
 void coerce_operand (NODE_T *, SOID_T *);
 void coerce_unit (NODE_T *, SOID_T *);
 void free_soid_list (SOID_T *);
+void init_coercion_memo (void);
 void investigate_firm_relations (PACK_T *, PACK_T *, BOOL_T *, BOOL_T *);
 void make_coercion (NODE_T *, int, MOID_T *);
 void make_depreffing_coercion (NODE_T *, MOID_T *, MOID_T *);
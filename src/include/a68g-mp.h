@@ -32,6 +32,13 @@
 #define MP_MAX_DECIMALS 250
 #define MP_MAX_DIGITS (1 + MP_MAX_DECIMALS / LOG_MP_RADIX)
 
+// From these lengths on, mul_mp and div_mp use the subquadratic routines
+// in mp-fast.c. They lie above the digits that MP_MAX_DECIMALS needs, even
+// when mp-gamma.c doubles them for guard digits.
+
+#define MP_FAST_DIGITS (2 * MP_MAX_DIGITS + 8)
+#define MP_NEWTON_DIGITS MP_FAST_DIGITS
+
 #define MP_STATUS(z) ((z)[0])
 #define MP_EXPONENT(z) ((z)[1])
 #define MP_DIGIT(z, n) ((z)[(n) + 1])
@@ -91,6 +98,7 @@ static inline MP_T *mp_one (int digs)
       a68_free (A68_MP (mp_one));
     }
     A68_MP (mp_one) = (MP_T *) get_heap_space (SIZE_MP (digs));
+    A68_MP (mp_one_size) = digs;
     set_mp (A68_MP (mp_one), 1, 0, digs);
   }
   return A68_MP (mp_one);
@@ -133,6 +141,24 @@ static inline MP_T *empty_mp (NODE_T *p, int digs)
   return (MP_T *) STACK_ADDRESS (pop_sp);
 }
 
+// Temporaries of the MP kernels come from a workspace that, unlike the
+// expression stack, is not copied when PAR units switch and is not checked
+// for overflow on every request. It only grows when nothing is allocated
+// from it; until then the expression stack takes over, so callers restore
+// both A68_SP and the workspace top. Contents are undefined.
+
+extern MP_T *scratch_mp_overflow (NODE_T *, int);
+
+static inline MP_T *scratch_mp (NODE_T *p, int digs)
+{
+  size_t top = A68_MP (mp_scratch_top), size = SIZE_MP (digs);
+  if (top + size > A68_MP (mp_scratch_size)) {
+    return scratch_mp_overflow (p, digs);
+  }
+  A68_MP (mp_scratch_top) = top + size;
+  return (MP_T *) &(A68_MP (mp_scratch)[top]);
+}
+
 extern MP_T *lengthen_mp (NODE_T *, MP_T *, int, MP_T *, int);
 
 static inline MP_T *len_mp (NODE_T *p, MP_T *u, int digs, int gdigs)
@@ -308,6 +334,7 @@ MP_T *ctan_mp (NODE_T *, MP_T *, MP_T *, int);
 MP_T *curt_mp (NODE_T *, MP_T *, MP_T *, int);
 MP_T *div_mp_digit (NODE_T *, MP_T *, MP_T *, MP_T, int);
 MP_T *div_mp (NODE_T *, MP_T *, MP_T *, MP_T *, int);
+MP_T *div_mp_newton (NODE_T *, MP_T *, MP_T *, MP_T *, int);
 MP_T *entier_mp (NODE_T *, MP_T *, MP_T *, int);
 MP_T *erfc_mp (NODE_T *, MP_T *, MP_T *, int);
 MP_T *erf_mp (NODE_T *, MP_T *, MP_T *, int);
@@ -339,6 +366,7 @@ MP_T *one_minus_mp (NODE_T *, MP_T *, MP_T *, int);
 MP_T *over_mp_digit (NODE_T *, MP_T *, MP_T *, MP_T, int);
 MP_T *over_mp (NODE_T *, MP_T *, MP_T *, MP_T *, int);
 MP_T *plus_one_mp (NODE_T *, MP_T *, MP_T *, int);
+MP_T *plusab_mp (NODE_T *, MP_T *, MP_T *, int);
 MP_T *pow_mp_int (NODE_T *, MP_T *, MP_T *, INT_T, int);
 MP_T *pow_mp (NODE_T *, MP_T *, MP_T *, MP_T *, int);
 MP_T *real_to_mp (NODE_T *, MP_T *, REAL_T, int);
@@ -360,6 +388,7 @@ MP_T *tanh_mp (NODE_T *, MP_T *, MP_T *, int);
 MP_T *tan_mp (NODE_T *, MP_T *, MP_T *, int);
 MP_T *tanpi_mp (NODE_T *, MP_T *, MP_T *, int);
 MP_T *tenth_mp (NODE_T *, MP_T *, MP_T *, int);
+MP_T *timesab_mp_digit (NODE_T *, MP_T *, MP_T, int);
 MP_T *trunc_mp (NODE_T *, MP_T *, MP_T *, int);
 MP_T *unt_to_mp (NODE_T *, MP_T *, UNSIGNED_T, int);
 REAL_T mp_to_real (NODE_T *, MP_T *, int);
@@ -369,6 +398,7 @@ void genie_pi_mp (NODE_T *);
 void gt_mp (NODE_T *, A68_BOOL *, MP_T *, MP_T *, int);
 void le_mp (NODE_T *, A68_BOOL *, MP_T *, MP_T *, int);
 void lt_mp (NODE_T *, A68_BOOL *, MP_T *, MP_T *, int);
+void mul_mp_fast (MP_T *, MP_T *, MP_T *, int, int);
 void ne_mp (NODE_T *, A68_BOOL *, MP_T *, MP_T *, int);
 void raw_write_mp (char *, MP_T *, int);
 void set_long_mp_digits (int);
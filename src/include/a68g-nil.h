@@ -31,6 +31,7 @@
 #define NO_BOOK ((BOOK_T *) NULL)
 #define NO_BOOL ((BOOL_T *) NULL)
 #define NO_BYTE ((BYTE_T *) NULL)
+#define NO_BYTECODE ((BYTECODE_T *) NULL)
 #define NO_CONSTANT ((void *) NULL)
 #define NO_DEC ((DEC_T *) NULL)
 #define NO_DIAGNOSTIC ((DIAGNOSTIC_T *) NULL)
@@ -50,6 +51,8 @@
 #define NO_POSTULATE ((POSTULATE_T *) NULL)
 #define NO_PPROC ((PROP_T (*) (NODE_T *)) NULL)
 #define NO_PROCEDURE ((A68_PROCEDURE *) NULL)
+#define NO_PROFILE ((PROFILE_T *) NULL)
+#define NO_PROFILE_CONTEXT ((PROFILE_CONTEXT_T *) NULL)
 #define NO_REAL ((REAL_T *) NULL)
 #define NO_REFINEMENT ((REFINEMENT_T *) NULL)
 #define NO_REGMATCH ((regmatch_t *) NULL)
@@ -71,9 +74,7 @@ static const A68_HANDLE nil_handle = {
   INIT_MASK,
   NO_BYTE,
   0,
-  NO_MOID,
-  NO_HANDLE,
-  NO_HANDLE
+  NO_MOID
 };
 
 static const A68_REF nil_ref = {
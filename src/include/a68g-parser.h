@@ -77,6 +77,7 @@ TABLE_T *new_symbol_table (TABLE_T *);
 TAG_T *add_tag (TABLE_T *, int, NODE_T *, MOID_T *, int);
 TAG_T *find_tag_global (TABLE_T *, int, char *);
 TAG_T *find_tag_local (TABLE_T *, int, const char *);
+TAG_T *next_tag_local (TABLE_T *, int, TAG_T *);
 TAG_T *new_tag (void);
 TOKEN_T *add_token (TOKEN_T **, char *);
 void a68_parser (void);
@@ -110,9 +111,11 @@ void extract_variables (NODE_T *);
 void fill_symbol_table_outer (NODE_T *, TABLE_T *);
 void finalise_symbol_table_setup (NODE_T *, int);
 void free_genie_heap (NODE_T *);
+void free_tag_indices (void);
 void get_max_simplout_size (NODE_T *);
 void get_refinements (void);
 void ignore_superfluous_semicolons (NODE_T *);
+void index_modes (BOOL_T);
 void init_before_tokeniser (void);
 void init_parser (void);
 void jumps_from_procs (NODE_T * p);
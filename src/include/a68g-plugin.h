@@ -60,7 +60,7 @@ union UFU
 #define NEEDS_DNS(m) (m != NO_MOID && (IS (m, REF_SYMBOL) || IS (m, PROC_SYMBOL) || IS (m, UNION_SYMBOL) || IS (m, FORMAT_SYMBOL)))
 
 #define CODE_EXECUTE(p) {\
-  indentf (out, a68_bufprt (A68 (edit_line), SNPRINTF_SIZE, "GENIE_UNIT_TRACE (_NODE_ (%d));", NUMBER (p)));\
+  indentf (out, a68_bufprt (A68 (edit_line), SNPRINTF_SIZE, "GENIE_UNIT_TRACE (_NODE_ (%d));", unit_number (p)));\
   }
 
 #define NAME_SIZE 200
@@ -123,7 +123,10 @@ char *make_unic_name (char *, char *, char *, char *);
 char *moid_with_name (char *, MOID_T *, char *);
 DEC_T *add_declaration (DEC_T **, char *, int, char *);
 DEC_T *add_identifier (DEC_T **, int, char *);
+FILE_T unit_out (NODE_T *, FILE_T);
+int unit_number (NODE_T *);
 NODE_T *stems_from (NODE_T *, int);
+uint64_t plugin_hash (uint64_t, const char *, size_t);
 void comment_source (NODE_T *, FILE_T);
 void constant_folder (NODE_T *, FILE_T, int);
 void gen_assign (NODE_T *, FILE_T, char *);
@@ -179,6 +182,7 @@ enum
 { L_NONE = 0, L_DECLARE = 1, L_INITIALISE, L_EXECUTE, L_EXECUTE_2, L_YIELD, L_PUSH };
 
 #define UNIC_NAME(k) (A68_OPT (unic_functions)[k].fun)
+#define PLUGIN_UNIT(k) (&A68_OPT (unit)[k])
 
 enum
 { UNIC_EXISTS, UNIC_MAKE_NEW, UNIC_MAKE_ALT };
@@ -26,10 +26,13 @@
 #if !defined (__A68G_POSTULATES_H__)
 #define __A68G_POSTULATES_H__
 
+BOOL_T is_disproved (const MOID_T *, const MOID_T *);
 void init_postulates (void);
 void free_postulate_list (POSTULATE_T *, const POSTULATE_T *);
+void make_disproof (MOID_T *, MOID_T *);
+void new_proof (void);
 void make_postulate (POSTULATE_T **, MOID_T *, MOID_T *);
 POSTULATE_T *is_postulated (POSTULATE_T *, const MOID_T *);
-POSTULATE_T *is_postulated_pair (POSTULATE_T *, const MOID_T *, const MOID_T *);
+POSTULATE_T *is_postulated_pair (const MOID_T *, const MOID_T *);
 
 #endif
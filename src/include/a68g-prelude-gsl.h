@@ -220,7 +220,6 @@ GPROC genie_fft_inverse;
 GPROC genie_complex_scale_matrix_complex;
 GPROC genie_complex_scale_vector_complex;
 GPROC genie_left_columns;
-GPROC genie_matrix_add;
 GPROC genie_matrix_ch;
 GPROC genie_matrix_ch_solve;
 GPROC genie_matrix_column_mean;
@@ -242,24 +241,17 @@ GPROC genie_matrix_complex_plusab;
 GPROC genie_matrix_complex_scale_complex;
 GPROC genie_matrix_complex_scale_complex_ab;
 GPROC genie_matrix_complex_sub;
-GPROC genie_matrix_complex_times_matrix;
 GPROC genie_matrix_complex_times_vector;
 GPROC genie_matrix_complex_trace;
 GPROC genie_matrix_complex_transpose;
 GPROC genie_matrix_det;
-GPROC genie_matrix_div_real;
-GPROC genie_matrix_div_real_ab;
 GPROC genie_matrix_echo;
-GPROC genie_matrix_eq;
 GPROC genie_matrix_hcat;
 GPROC genie_matrix_inv;
 GPROC genie_matrix_lu;
 GPROC genie_matrix_lu_det;
 GPROC genie_matrix_lu_inv;
 GPROC genie_matrix_lu_solve;
-GPROC genie_matrix_minus;
-GPROC genie_matrix_minusab;
-GPROC genie_matrix_ne;
 GPROC genie_matrix_norm;
 GPROC genie_matrix_ols;
 GPROC genie_matrix_pca_cv;
@@ -270,24 +262,16 @@ GPROC genie_matrix_pinv;
 GPROC genie_matrix_pinv_lim;
 GPROC genie_matrix_pls1;
 GPROC genie_matrix_pls2;
-GPROC genie_matrix_plusab;
 GPROC genie_matrix_qr;
 GPROC genie_matrix_qr_ls_solve;
 GPROC genie_matrix_qr_solve;
-GPROC genie_matrix_scale_real;
-GPROC genie_matrix_scale_real_ab;
-GPROC genie_matrix_sub;
 GPROC genie_matrix_svd;
 GPROC genie_matrix_svd_solve;
-GPROC genie_matrix_times_matrix;
 GPROC genie_matrix_times_vector;
 GPROC genie_matrix_tls;
 GPROC genie_matrix_trace;
 GPROC genie_matrix_transpose;
 GPROC genie_matrix_vcat;
-GPROC genie_real_scale_matrix;
-GPROC genie_real_scale_vector;
-GPROC genie_vector_add;
 GPROC genie_vector_col;
 GPROC genie_vector_complex_add;
 GPROC genie_vector_complex_div_complex;
@@ -305,21 +289,10 @@ GPROC genie_vector_complex_scale_complex;
 GPROC genie_vector_complex_scale_complex_ab;
 GPROC genie_vector_complex_sub;
 GPROC genie_vector_complex_times_matrix;
-GPROC genie_vector_div_real;
-GPROC genie_vector_div_real_ab;
-GPROC genie_vector_dot;
 GPROC genie_vector_dyad;
 GPROC genie_vector_echo;
-GPROC genie_vector_eq;
-GPROC genie_vector_minus;
-GPROC genie_vector_minusab;
-GPROC genie_vector_ne;
 GPROC genie_vector_norm;
-GPROC genie_vector_plusab;
 GPROC genie_vector_row;
-GPROC genie_vector_scale_real;
-GPROC genie_vector_scale_real_ab;
-GPROC genie_vector_sub;
 GPROC genie_vector_times_matrix;
 
 // Constants ex GSL
@@ -78,6 +78,7 @@ BOOL_T close_device (NODE_T *, A68_FILE *);
 BOOL_T genie_int_case_unit (NODE_T *, int, int *);
 BOOL_T increment_internal_index (A68_TUPLE *, int);
 char *a_to_c_string (NODE_T *, char *, A68_REF);
+char *fused_propagator_name (const PROP_PROC * p);
 char *propagator_name (const PROP_PROC * p);
 FILE *a68_fopen (char *, char *, char *);
 GPROC get_global_level;
@@ -105,6 +106,7 @@ void change_masks (NODE_T *, unt, BOOL_T);
 void colour_object (BYTE_T *, MOID_T *);
 void deltagammainc (REAL_T *, REAL_T *, REAL_T, REAL_T, REAL_T, REAL_T);
 void exit_genie (NODE_T *, int);
+void free_regex_cache (void);
 void gc_heap (NODE_T *, ADDR_T);
 void genie_call_event_routine (NODE_T *, MOID_T *, A68_PROCEDURE *, ADDR_T, ADDR_T);
 void genie_call_operator (NODE_T *, ADDR_T);
@@ -115,8 +117,10 @@ void genie_find_proc_op (NODE_T *, int *);
 void genie_free (NODE_T *);
 void genie_generator_internal (NODE_T *, MOID_T *, TAG_T *, LEAP_T, ADDR_T);
 void genie_generator_stowed (NODE_T *, BYTE_T *, NODE_T **, ADDR_T *);
+void genie_init_profile (void);
 void genie_init_rng (void);
 void genie_preprocess (NODE_T *, int *, void *);
+void genie_profile_report (void);
 void genie_push_undefined (NODE_T *, MOID_T *);
 void genie_read_standard_format (NODE_T *, MOID_T *, BYTE_T *, A68_REF, int *);
 void genie_read_standard (NODE_T *, MOID_T *, BYTE_T *, A68_REF);
@@ -136,11 +140,15 @@ void mp_strtou (NODE_T *, MP_T *, char *, MOID_T *);
 void open_format_frame (NODE_T *, A68_REF, A68_FORMAT *, BOOL_T, BOOL_T);
 void print_internal_index (FILE_T, A68_TUPLE *, int);
 void print_item (NODE_T *, FILE_T, BYTE_T *, MOID_T *);
+void profile_call (NODE_T *, BYTE_T *);
+void profile_return (BYTE_T *);
+void profile_unit (NODE_T *);
 void purge_format_read (NODE_T *, A68_REF);
 void purge_format_write (NODE_T *, A68_REF);
 void single_step (NODE_T *, unt);
 void skip_nl_ff (NODE_T *, int *, A68_REF);
 void stack_dump (FILE_T, ADDR_T, int, int *);
+void unshare_string (NODE_T *, A68_REF *);
 void value_sign_error (NODE_T *, MOID_T *, A68_REF);
 void where_in_source (FILE_T, NODE_T *);
 
@@ -238,6 +246,19 @@ GPROC genie_create_pipe;
 GPROC genie_csc_real;
 GPROC genie_cscdg_real;
 GPROC genie_curt_real;
+GPROC genie_matrix_add;
+GPROC genie_matrix_complex_times_matrix;
+GPROC genie_matrix_div_real;
+GPROC genie_matrix_div_real_ab;
+GPROC genie_matrix_eq;
+GPROC genie_matrix_minus;
+GPROC genie_matrix_minusab;
+GPROC genie_matrix_ne;
+GPROC genie_matrix_plusab;
+GPROC genie_matrix_scale_real;
+GPROC genie_matrix_scale_real_ab;
+GPROC genie_matrix_sub;
+GPROC genie_matrix_times_matrix;
 GPROC genie_r128mach;
 GPROC genie_debug;
 GPROC genie_declaration;
@@ -527,10 +548,14 @@ GPROC genie_read_long_real;
 GPROC genie_read_real;
 GPROC genie_read_string;
 GPROC genie_real_lengths;
+GPROC genie_real_scale_matrix;
+GPROC genie_real_scale_vector;
 GPROC genie_realpath;
 GPROC genie_real_shorths;
 GPROC genie_real_width;
 GPROC genie_re_complex;
+GPROC genie_regex_cache_hits;
+GPROC genie_regex_cache_misses;
 GPROC genie_reidf_possible;
 GPROC genie_repr_char;
 GPROC genie_reset;
@@ -615,6 +640,25 @@ GPROC genie_to_lower;
 GPROC genie_to_upper;
 GPROC genie_unimplemented;
 GPROC genie_utctime;
+GPROC genie_vector_add;
+GPROC genie_vector_add_int;
+GPROC genie_vector_div_real;
+GPROC genie_vector_div_real_ab;
+GPROC genie_vector_dot;
+GPROC genie_vector_eq;
+GPROC genie_vector_eq_int;
+GPROC genie_vector_minus;
+GPROC genie_vector_minus_int;
+GPROC genie_vector_minusab;
+GPROC genie_vector_minusab_int;
+GPROC genie_vector_ne;
+GPROC genie_vector_ne_int;
+GPROC genie_vector_plusab;
+GPROC genie_vector_plusab_int;
+GPROC genie_vector_scale_real;
+GPROC genie_vector_scale_real_ab;
+GPROC genie_vector_sub;
+GPROC genie_vector_sub_int;
 GPROC genie_waitpid;
 GPROC genie_whole;
 GPROC genie_write;
@@ -29,6 +29,8 @@
 #include "a68g-genie.h"
 #include "a68g-prelude.h"
 
+void torrix_dgemm (int, int, int, REAL_T, REAL_T *, int, int, REAL_T *, int, int, REAL_T, REAL_T *, int, int);
+
 #if defined (HAVE_GSL)
 
 #define NO_REAL_MATRIX ((gsl_matrix *) NULL)
@@ -66,6 +68,8 @@ void push_permutation (NODE_T *, gsl_permutation *);
 void push_vector_complex (NODE_T *, gsl_vector_complex *);
 void push_vector (NODE_T *, gsl_vector *);
 void torrix_error_handler (const char *, const char *, int, int);
+void torrix_get_block (NODE_T *, MOID_T *, BYTE_T *, int, int, int, int, REAL_T *, size_t);
+void torrix_put_block (NODE_T *, MOID_T *, const REAL_T *, size_t, int, int, BYTE_T *, int, int);
 void torrix_test_error (int);
 
 // BLAS support
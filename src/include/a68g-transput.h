@@ -58,6 +58,7 @@ int get_replicator_value (NODE_T *, BOOL_T);
 int get_transput_buffer_index (int);
 int get_transput_buffer_size (int);
 int get_unblocked_transput_buffer (NODE_T *);
+int span_char_scanner (A68_FILE *, char *, char **);
 int store_file_entry (NODE_T *, FILE_T, char *, BOOL_T);
 void add_a_string_transput_buffer (NODE_T *, int, BYTE_T *);
 void add_chars_transput_buffer (NODE_T *, int, int, char *);
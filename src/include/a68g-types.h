@@ -57,6 +57,7 @@ typedef struct A68_STREAM A68_STREAM;
 typedef struct A68_TUPLE A68_TUPLE;
 typedef struct A68_UNION A68_UNION;
 typedef struct ACTIVATION_RECORD ACTIVATION_RECORD;
+typedef struct BYTECODE_T BYTECODE_T;
 typedef struct DEC_T DEC_T;
 typedef struct DIAGNOSTIC_T DIAGNOSTIC_T;
 typedef struct FILES_T FILES_T;
@@ -70,10 +71,14 @@ typedef struct OPTION_LIST_T OPTION_LIST_T;
 typedef struct OPTIONS_T OPTIONS_T;
 typedef struct PACK_T PACK_T;
 typedef struct POSTULATE_T POSTULATE_T;
+typedef struct PROFILE_CONTEXT_T PROFILE_CONTEXT_T;
+typedef struct PROFILE_FRAME_T PROFILE_FRAME_T;
+typedef struct PROFILE_T PROFILE_T;
 typedef struct PROP_T PROP_T;
 typedef struct REFINEMENT_T REFINEMENT_T;
 typedef struct SOID_T SOID_T;
 typedef struct TABLE_T TABLE_T;
+typedef struct TAG_INDEX_T TAG_INDEX_T;
 typedef struct TAG_T TAG_T;
 typedef struct TOKEN_T TOKEN_T;
 typedef unt FILE_T, MOOD_T;
@@ -164,7 +169,7 @@ struct MODES_T
 struct OPTIONS_T
 {
   OPTION_LIST_T *list;
-  BOOL_T backtrace, brackets, check_only, clock, cross_reference, debug, compile, compile_check, keep, fold, license, moid_listing, object_listing, portcheck, pragmat_sema, pretty, reductions, regression_test, run, rerun, run_script, source_listing, standard_prelude_listing, statistics_listing, strict, stropping, trace, tree_listing, unused, verbose, version, no_warnings, quiet;
+  BOOL_T backtrace, blas, brackets, bytecode, cache, check_only, clock, cross_reference, debug, compile, compile_check, keep, fold, license, moid_listing, object_listing, portcheck, pragmat_sema, pretty, reductions, regression_test, run, rerun, run_script, source_listing, standard_prelude_listing, statistics_listing, strict, stropping, trace, profile, tree_listing, unused, verbose, version, no_warnings, quiet;
   int time_limit, opt_level, indent;
   STATUS_MASK_T nodemask;
 };
@@ -203,13 +208,48 @@ struct NODE_INFO_T
 struct GINFO_T
 {
   PROP_T propagator;
-  BOOL_T is_coercion, is_new_lexical_level, need_dns;
+  BOOL_T is_coercion, is_new_lexical_level, need_dns, is_initialised;
   BYTE_T *offset;
   MOID_T *partial_proc, *partial_locale;
   NODE_T *parent;
   char *compile_name;
   int level, argsize, size, compile_node;
   void *constant;
+  PROFILE_T *profile;
+  BYTECODE_T *bytecode;
+};
+
+//! @brief Profile of a unit or a routine.
+
+struct PROFILE_T
+{
+  NODE_T *node;
+  char *name;
+  int active;
+  UNSIGNED_T count, heap;
+  REAL_T inclusive, exclusive;
+  PROFILE_T *next;
+};
+
+//! @brief Node in the tree of calling contexts, for collapsed stacks.
+
+struct PROFILE_CONTEXT_T
+{
+  PROFILE_T *routine;
+  REAL_T self_time;
+  PROFILE_CONTEXT_T *parent, *sub, *next;
+};
+
+//! @brief Activation of a unit or a routine while profiling.
+
+struct PROFILE_FRAME_T
+{
+  PROFILE_T *profile;
+  PROFILE_CONTEXT_T *context;
+  ptrdiff_t system_depth;
+  int caller;
+  REAL_T start, children, callees;
+  UNSIGNED_T heap, child_heap, callee_heap;
 };
 
 struct OPTION_LIST_T
@@ -234,7 +274,7 @@ struct PACK_T
 struct POSTULATE_T
 {
   MOID_T *a, *b;
-  POSTULATE_T *next;
+  POSTULATE_T *next, *homonym;
 };
 
 struct REFINEMENT_T
@@ -271,10 +311,23 @@ struct TABLE_T
   ADDR_T ap_increment;
   TABLE_T *previous, *outer;
   TAG_T *identifiers, *operators, *priority, *indicants, *labels, *anonymous;
+  TAG_INDEX_T *identifier_index, *operator_index, *priority_index, *indicant_index, *label_index;
   NODE_T *jump_to, *sequence;
 };
 #define NO_TABLE ((TABLE_T *) NULL)
 
+// Hash index of a tag list, from symbol to the first tag with that symbol.
+// Further tags with the same symbol follow through HOMONYM, in list order.
+// Lists only grow at their head, so an index catches up from "list" onwards.
+
+struct TAG_INDEX_T
+{
+  TAG_T *list, **slots;
+  TAG_INDEX_T *next;
+  int size, used;
+};
+#define NO_TAG_INDEX ((TAG_INDEX_T *) NULL)
+
 struct TAG_T
 {
   STATUS_MASK_T status, codex;
@@ -286,7 +339,7 @@ struct TAG_T
   BOOL_T scope_assigned, use, in_proc, a68_standenv_proc, loc_assigned, portable;
   int priority, heap, scope, size, youngest_environ, number;
   ADDR_T offset;
-  TAG_T *next, *body;
+  TAG_T *next, *body, *homonym;
 };
 #define NO_TAG ((TAG_T *) NULL)
 
@@ -302,6 +355,7 @@ struct TOKEN_T
 //! A REF into the HEAP points at a HANDLE.
 //! The HANDLE points at the actual object in the HEAP.
 //! Garbage collection modifies HANDLEs, but not REFs.
+//! HANDLEs live in one table; a bitmap records which are in use.
 
 struct A68_HANDLE
 {
@@ -309,7 +363,6 @@ struct A68_HANDLE
   BYTE_T *pointer;
   int size;
   MOID_T *type;
-  A68_HANDLE *next, *previous;
 } ALIGNED;
 
 //! @struct A68_REF
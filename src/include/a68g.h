@@ -48,6 +48,12 @@
 #  undef BUILD_A68_COMPILER
 #endif
 
+#if (defined (BUILD_LINUX) || defined (BUILD_BSD))
+#  define BUILD_MMAP
+#else
+#  undef BUILD_MMAP
+#endif
+
 #if defined (BUILD_LINUX)
 #  define BUILD_UNIX
 #elif defined (BUILD_BSD)